@@ -0,0 +1,124 @@
+/**
+ * @file
+ * @author Patrick Bridges <pbridges@unm.edu>
+ * @author Jered Dominguez-Trujillo <jereddt@unm.edu>
+ *
+ * @section DESCRIPTION
+ * Benchmark of the cell state storage for the finite volume stencil
+ * Each cell reads height and momentum of its neighbors one and two cells away along each dimension and writes its new state
+ * Compares separate row-major height and momentum arrays with height and momentum interleaved in an AoSoA
+ */
+
+// Include Statements
+#include <CellState.hpp>
+#include <TimeIntegration.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <stdlib.h>
+#include <string>
+
+// Fill a Time Level with a Dam Break: Tall Column in the Middle, at Rest
+template <class HeightView, class MomentumView>
+void initialize( const long side, const HeightView &h, const MomentumView &u ) {
+    Kokkos::parallel_for(
+        "Cell_State_Initialize", Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>( 0, side * side ), KOKKOS_LAMBDA( const long n ) {
+            long i = n / side, j = n % side;
+            long r = side / 8;
+
+            h( i, j, 0, 0 ) = ( ( i - side / 2 ) * ( i - side / 2 ) + ( j - side / 2 ) * ( j - side / 2 ) < r * r ) ? 10.0 : 2.0;
+            u( i, j, 0, 0 ) = 0.0;
+            u( i, j, 0, 1 ) = 0.0;
+        } );
+}
+
+// Time the Shallow Water Update of the Interior, Alternating Between Two Time Levels
+template <class HeightView, class MomentumView>
+void benchmark( const std::string &name, const long side, const int repetitions, const HeightView h[2], const MomentumView u[2] ) {
+    const double dt = 0.01, dx = 1.0, dy = 1.0, gravity = 9.80, ghalf = 0.5 * gravity;
+
+    initialize( side, h[0], u[0] );
+    initialize( side, h[1], u[1] );
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for ( int r = 0; r < repetitions; r++ ) {
+        auto h_current = h[r % 2];
+        auto u_current = u[r % 2];
+        auto h_new     = h[( r + 1 ) % 2];
+        auto u_new     = u[( r + 1 ) % 2];
+
+        Kokkos::parallel_for(
+            "Cell_State_Benchmark", Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>( 0, ( side - 4 ) * ( side - 4 ) ), KOKKOS_LAMBDA( const long n ) {
+                long i = 2 + n / ( side - 4 ), j = 2 + n % ( side - 4 ), k = 0;
+
+                double h_x[5] = { h_current( i - 2, j, k, 0 ), h_current( i - 1, j, k, 0 ), h_current( i, j, k, 0 ), h_current( i + 1, j, k, 0 ), h_current( i + 2, j, k, 0 ) };
+                double h_y[5] = { h_current( i, j - 2, k, 0 ), h_current( i, j - 1, k, 0 ), h_current( i, j, k, 0 ), h_current( i, j + 1, k, 0 ), h_current( i, j + 2, k, 0 ) };
+                double u_x[5] = { u_current( i - 2, j, k, 0 ), u_current( i - 1, j, k, 0 ), u_current( i, j, k, 0 ), u_current( i + 1, j, k, 0 ), u_current( i + 2, j, k, 0 ) };
+                double u_y[5] = { u_current( i, j - 2, k, 0 ), u_current( i, j - 1, k, 0 ), u_current( i, j, k, 0 ), u_current( i, j + 1, k, 0 ), u_current( i, j + 2, k, 0 ) };
+                double v_x[5] = { u_current( i - 2, j, k, 1 ), u_current( i - 1, j, k, 1 ), u_current( i, j, k, 1 ), u_current( i + 1, j, k, 1 ), u_current( i + 2, j, k, 1 ) };
+                double v_y[5] = { u_current( i, j - 2, k, 1 ), u_current( i, j - 1, k, 1 ), u_current( i, j, k, 1 ), u_current( i, j + 1, k, 1 ), u_current( i, j + 2, k, 1 ) };
+
+                double state[3];
+                ExaCLAMR::TimeIntegrator::cellUpdate( dt, dx, dy, gravity, ghalf, h_x, h_y, u_x, u_y, v_x, v_y, state );
+
+                h_new( i, j, k, 0 ) = state[0];
+                u_new( i, j, k, 0 ) = state[1];
+                u_new( i, j, k, 1 ) = state[2];
+            } );
+    }
+    Kokkos::fence();
+    auto stop = std::chrono::high_resolution_clock::now();
+
+    // Total Height of the Last Time Level - Equal for Every Storage
+    auto   h_last = h[repetitions % 2];
+    double sum    = 0.0;
+    Kokkos::parallel_reduce(
+        "Cell_State_Checksum", Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>( 0, side * side ), KOKKOS_LAMBDA( const long n, double &lsum ) {
+            lsum += h_last( n / side, n % side, 0, 0 );
+        },
+        sum );
+
+    double seconds = std::chrono::duration<double>( stop - start ).count();
+    double cells   = (double)( side - 4 ) * ( side - 4 ) * repetitions;
+    std::cout << std::left << std::setw( 12 ) << name << std::setw( 16 ) << seconds * 1.0e9 / cells << std::setprecision( 12 ) << sum << "\n";
+}
+
+int main( int argc, char *argv[] ) {
+    Kokkos::initialize( argc, argv );
+    {
+        // Mesh Side and Repetitions
+        long side        = ( argc > 1 ) ? atol( argv[1] ) : 512;
+        int  repetitions = ( argc > 2 ) ? atoi( argv[2] ) : 10;
+
+        if ( side < 8 ) side = 8;
+
+        std::cout << "Cell State Benchmark: " << side << " x " << side << " Cells, " << repetitions << " Repetitions, AoSoA Vector " << EXACLAMR_AOSOA_VECTOR << "\n";
+        std::cout << std::left << std::setw( 12 ) << "Storage" << std::setw( 16 ) << "ns / Cell" << "Checksum\n";
+
+        // Separate Row-Major Height and Momentum Arrays
+        typedef Kokkos::View<double ****, Kokkos::LayoutRight, Kokkos::HostSpace> soa_view;
+
+        soa_view soa_h[2] = { soa_view( "height", side, side, 1, 1 ), soa_view( "height", side, side, 1, 1 ) };
+        soa_view soa_u[2] = { soa_view( "momentum", side, side, 1, 2 ), soa_view( "momentum", side, side, 1, 2 ) };
+
+        benchmark( "soa", side, repetitions, soa_h, soa_u );
+
+        // Height and Momentum Interleaved in an AoSoA
+        typedef ExaCLAMR::CellStateAoSoA<double, EXACLAMR_AOSOA_VECTOR, Kokkos::HostSpace> aosoa_state;
+        typedef typename aosoa_state::view_type                                            aosoa_view;
+
+        aosoa_state state_a( "cell_state", side, side, 1 );
+        aosoa_state state_b( "cell_state", side, side, 1 );
+
+        aosoa_view aosoa_h[2] = { state_a.view( 0, 1 ), state_b.view( 0, 1 ) };
+        aosoa_view aosoa_u[2] = { state_a.view( 1, 2 ), state_b.view( 1, 2 ) };
+
+        benchmark( "aosoa", side, repetitions, aosoa_h, aosoa_u );
+    }
+    Kokkos::finalize();
+
+    return 0;
+};
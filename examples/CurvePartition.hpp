@@ -0,0 +1,268 @@
+/**
+ * @file
+ * @author Patrick Bridges <pbridges@unm.edu>
+ * @author Jered Dominguez-Trujillo <jereddt@unm.edu>
+ *
+ * @section DESCRIPTION
+ * Space-filling curve partition of the global cell index space, for the -y hilbert report of the dam break example
+ * Cuts the cells along the Hilbert curve into one contiguous segment of equal work per rank, for any rank count
+ * Lists the halo cells each rank sends to and receives from every neighboring segment
+ * Only measures the communication surface such a partition would have - the solver always runs on Cajita's rectangular blocks
+ */
+
+#ifndef EXACLAMR_CURVEPARTITION_HPP
+#define EXACLAMR_CURVEPARTITION_HPP
+
+#ifndef DEBUG
+#define DEBUG 0
+#endif
+
+// Include Statements
+#include <Decomposition.hpp>
+#include <SpaceFillingCurve.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <array>
+#include <iostream>
+#include <map>
+#include <vector>
+
+namespace ExaCLAMR {
+
+    /**
+ * The CurvePartition Class
+ * @class CurvePartition
+ * @brief Partitions the cells of a 2-D index space into Hilbert curve segments
+ * The ranks find the cuts together, each walking one chunk of the curve
+ * Every rank then holds the same cuts, so the owner of any cell is found without communication
+ * Segments are not rectangles, so the halo of a segment is a list of cells rather than an index space
+ **/
+    class CurvePartition {
+      public:
+        /**
+         * Constructor
+         * Cuts the curve into segments of equal cell count
+         *
+         * @param global_num_cells Global number of cells
+         * @param halo_size Number of halo cells
+         * @param periodic Periodicity of domain
+         * @param comm MPI communicator to partition over
+         */
+        CurvePartition( const std::array<int, 3> &global_num_cells, const int halo_size, const std::array<bool, 3> &periodic, MPI_Comm comm )
+            : CurvePartition( global_num_cells, halo_size, periodic, comm, []( const int, const int ) { return 1.0; } ){};
+
+        /**
+         * Constructor
+         * Cuts the curve into segments of equal work and finds the halo of this rank's segment
+         * Collective over the partitioned communicator
+         *
+         * @param global_num_cells Global number of cells
+         * @param halo_size Number of halo cells
+         * @param periodic Periodicity of domain
+         * @param comm MPI communicator to partition over
+         * @param work Work of the cell at ( i, j ) - any rank must give the same work for a cell
+         */
+        template <class WorkFunc>
+        CurvePartition( const std::array<int, 3> &global_num_cells, const int halo_size, const std::array<bool, 3> &periodic, MPI_Comm comm, const WorkFunc &work )
+            : _num_cells( { global_num_cells[0], global_num_cells[1] } )
+            , _periodic( { periodic[0], periodic[1] } )
+            , _halo_size( halo_size )
+            , _side( SpaceFillingCurve::coveringSide( global_num_cells[0], global_num_cells[1] ) )
+            , _curve( _side )
+            , _comm( comm ) {
+            int comm_size;
+            MPI_Comm_size( comm, &comm_size );
+            MPI_Comm_rank( comm, &_rank );
+
+            // Each Rank Walks One Equal Chunk of the Curve, so no Rank Holds the Global Cell List
+            long length = _side * _side;
+            long begin  = length * _rank / comm_size, end = length * ( _rank + 1 ) / comm_size;
+
+            // Work of Each Chunk and the Work Before it
+            double chunk_work = 0.0;
+            for ( long d = begin; d < end; d++ ) {
+                long x, y;
+                SpaceFillingCurve::hilbertCoords( _side, d, x, y );
+                if ( x < _num_cells[0] && y < _num_cells[1] ) chunk_work += work( x, y );
+            }
+            std::vector<double> chunk_works( comm_size );
+            MPI_Allgather( &chunk_work, 1, MPI_DOUBLE, chunk_works.data(), 1, MPI_DOUBLE, comm );
+
+            double before = 0.0, total = 0.0;
+            for ( int r = 0; r < comm_size; r++ ) {
+                if ( r == _rank ) before = total;
+                total += chunk_works[r];
+            }
+
+            // Segment r Starts at the First Cell Whose Preceding Work Reaches r Shares of the Total
+            // Each Rank Places the Cuts Reached in its Chunk - the Earliest Placement of Each Cut Wins
+            std::vector<long> starts( comm_size + 1, length );
+            int               cut = 1;
+            for ( long d = begin; d < end && cut < comm_size; d++ ) {
+                long x, y;
+                SpaceFillingCurve::hilbertCoords( _side, d, x, y );
+                if ( x >= _num_cells[0] || y >= _num_cells[1] ) continue;
+
+                for ( ; cut < comm_size && total * cut / comm_size <= before; cut++ ) starts[cut] = d;
+                before += work( x, y );
+            }
+            starts[0] = 0;
+
+            _starts.resize( comm_size + 1 );
+            MPI_Allreduce( starts.data(), _starts.data(), comm_size + 1, MPI_LONG, MPI_MIN, comm );
+
+            // Owned Cells: Only this Rank's Segment of the Curve
+            for ( long d = _starts[_rank]; d < _starts[_rank + 1]; d++ ) {
+                long x, y;
+                SpaceFillingCurve::hilbertCoords( _side, d, x, y );
+                if ( x < _num_cells[0] && y < _num_cells[1] ) _owned_cells.push_back( { (int)x, (int)y } );
+            }
+
+            // Ghost Cells: Other Ranks' Cells Within the Halo of an Owned Cell
+            // Shared Cells: Owned Cells Within the Halo of Another Rank's Cell - the Same Window Seen from the Other Side
+            std::map<int, std::vector<std::array<int, 2>>> ghosts, shared;
+            for ( auto &cell : _owned_cells ) {
+                std::vector<int> sharers;
+                for ( int di = -_halo_size; di <= _halo_size; di++ ) {
+                    for ( int dj = -_halo_size; dj <= _halo_size; dj++ ) {
+                        std::array<int, 2> other = { cell[0] + di, cell[1] + dj };
+                        if ( !wrap( other ) ) continue;
+
+                        int owner_rank = owner( other[0], other[1] );
+                        if ( owner_rank == _rank ) continue;
+
+                        ghosts[owner_rank].push_back( other );
+                        if ( std::find( sharers.begin(), sharers.end(), owner_rank ) == sharers.end() ) sharers.push_back( owner_rank );
+                    }
+                }
+                for ( int s : sharers ) shared[s].push_back( cell );
+            }
+
+            // Both Sides List the Cells in Curve Order, so the n-th Cell Sent is the n-th Cell Received
+            for ( auto &g : ghosts ) {
+                auto &list = g.second;
+                std::sort( list.begin(), list.end(), [&]( const std::array<int, 2> &a, const std::array<int, 2> &b ) { return curveIndex( a ) < curveIndex( b ); } );
+                list.erase( std::unique( list.begin(), list.end() ), list.end() );
+
+                _neighbors.push_back( g.first );
+                _recv_cells.push_back( list );
+                _send_cells.push_back( shared[g.first] );
+            }
+
+            if ( DEBUG ) std::cout << "Rank: " << _rank << " Curve Cells: " << _owned_cells.size() << " Neighbors: " << _neighbors.size() << "\n";
+        };
+
+        /**
+         * Position of a Cell Along the Curve
+         **/
+        long curveIndex( const std::array<int, 2> &cell ) const { return _curve.index( cell[0], cell[1] ); };
+
+        /**
+         * Rank Owning a Cell
+         **/
+        int owner( const int i, const int j ) const {
+            return std::upper_bound( _starts.begin(), _starts.end(), _curve.index( i, j ) ) - _starts.begin() - 1;
+        };
+
+        /**
+         * Cells of this Rank in Curve Order
+         **/
+        const std::vector<std::array<int, 2>> &ownedCells() const { return _owned_cells; };
+
+        /**
+         * Ranks Sharing Halo Cells with this Rank, in Ascending Order
+         **/
+        const std::vector<int> &neighbors() const { return _neighbors; };
+
+        /**
+         * Owned Cells Sent to a Neighbor, in Curve Order
+         * @param n Index of the neighbor in neighbors()
+         **/
+        const std::vector<std::array<int, 2>> &sendCells( const int n ) const { return _send_cells[n]; };
+
+        /**
+         * Ghost Cells Received from a Neighbor, in Curve Order
+         * @param n Index of the neighbor in neighbors()
+         **/
+        const std::vector<std::array<int, 2>> &recvCells( const int n ) const { return _recv_cells[n]; };
+
+        /**
+         * Measure the Communication Surface of the Partition
+         * Counts the faces between cells of different ranks, comparable with the halo surface of a block decomposition
+         * Collective over the partitioned communicator
+         *
+         * @param node_ids Node of each rank of the communicator
+         **/
+        DecompositionStats stats( const std::vector<int> &node_ids ) const {
+            long             halo_cells = 0;
+            std::vector<int> face_neighbors;
+            for ( auto &cell : _owned_cells ) {
+                for ( int d = 0; d < 2; d++ ) {
+                    for ( int side = -1; side < 2; side += 2 ) {
+                        std::array<int, 2> other = cell;
+                        other[d] += side;
+                        if ( !wrap( other ) ) continue;
+
+                        int owner_rank = owner( other[0], other[1] );
+                        if ( owner_rank == _rank ) continue;
+
+                        halo_cells++;
+                        if ( std::find( face_neighbors.begin(), face_neighbors.end(), owner_rank ) == face_neighbors.end() ) face_neighbors.push_back( owner_rank );
+                    }
+                }
+            }
+
+            int pairs = face_neighbors.size(), node_pairs = 0;
+            for ( int n : face_neighbors ) node_pairs += ( node_ids[n] == node_ids[_rank] );
+
+            DecompositionStats stats;
+            MPI_Allreduce( &halo_cells, &stats.halo_cells, 1, MPI_LONG, MPI_SUM, _comm );
+            MPI_Allreduce( &halo_cells, &stats.max_halo_cells, 1, MPI_LONG, MPI_MAX, _comm );
+            MPI_Allreduce( &pairs, &stats.pairs, 1, MPI_INT, MPI_SUM, _comm );
+            MPI_Allreduce( &node_pairs, &stats.node_pairs, 1, MPI_INT, MPI_SUM, _comm );
+
+            // Each Face and Pair was Counted from Both Sides
+            stats.halo_cells /= 2;
+            stats.pairs /= 2;
+            stats.node_pairs /= 2;
+
+            return stats;
+        };
+
+      private:
+        /**
+         * Wrap a Cell Across Periodic Boundaries
+         * @return Whether the cell lies in the index space
+         **/
+        bool wrap( std::array<int, 2> &cell ) const {
+            for ( int d = 0; d < 2; d++ ) {
+                if ( cell[d] >= 0 && cell[d] < _num_cells[d] ) continue;
+                if ( !_periodic[d] ) return false;
+                cell[d] = ( cell[d] + _num_cells[d] ) % _num_cells[d];
+            }
+            return true;
+        };
+
+        std::array<int, 2>  _num_cells; /**< Global number of cells */
+        std::array<bool, 2> _periodic;  /**< Periodicity of domain */
+        int                 _halo_size; /**< Number of halo cells */
+        int                 _rank;      /**< Rank in the partitioned communicator */
+        long                _side;      /**< Side of the square the curve covers */
+
+        SpaceFillingCurve::HilbertTable<Kokkos::HostSpace> _curve; /**< Hilbert index of the cells */
+        MPI_Comm                                           _comm;  /**< Partitioned communicator */
+
+        std::vector<long>                            _starts;      /**< Curve index of the first cell of each rank's segment */
+        std::vector<std::array<int, 2>>              _owned_cells; /**< Cells of this rank in curve order */
+        std::vector<int>                             _neighbors;   /**< Ranks sharing halo cells with this rank */
+        std::vector<std::vector<std::array<int, 2>>> _send_cells;  /**< Owned cells sent to each neighbor */
+        std::vector<std::vector<std::array<int, 2>>> _recv_cells;  /**< Ghost cells received from each neighbor */
+    };
+
+} // namespace ExaCLAMR
+
+#endif
@@ -17,6 +17,8 @@
 
 // Include Statements
 #include <BoundaryConditions.hpp>
+#include <CurvePartition.hpp>
+#include <Decomposition.hpp>
 #include <ExaClamrTypes.hpp>
 #include <Input.hpp>
 #include <Solver.hpp>
@@ -88,28 +90,61 @@ void clamr( ExaCLAMR::ClArgs<state_t> &cl, ExaCLAMR::BoundaryCondition &bc, ExaC
     MPI_Comm_rank( MPI_COMM_WORLD, &rank );      // Get My Rank
 
     timer.setupStart();
-    // Splits Ranks up as Evenly as Possible Across X and Y Dimensions
-    int x_ranks = comm_size;
-    while ( x_ranks % 2 == 0 && x_ranks > 2 ) {
-        x_ranks /= 2;
+    // Splits Ranks Across X and Y Dimensions - Least Halo Surface by Default
+    ExaCLAMR::Decomposition decomposition( cl, MPI_COMM_WORLD );
+    ExaCLAMR::DecompositionStats stats = decomposition.stats();
+
+    const std::array<int, 3> &ranks_per_dim = decomposition.ranksPerDim(); // Ranks per Dimension
+
+    // Only Rank 0 Prints the Communication Surface
+    if ( rank == 0 ) {
+        std::cout << "===========Decomposition============\n";
+        std::cout << std::left << std::setw( 20 ) << "Ranks per Dimension"
+                  << ": " << std::setw( 8 ) << ranks_per_dim[0] << std::setw( 8 ) << ranks_per_dim[1] << std::setw( 8 ) << ranks_per_dim[2] << "\n"; // Ranks per Dimension
+        std::cout << std::left << std::setw( 20 ) << "Node Mapped"
+                  << ": " << std::setw( 8 ) << decomposition.nodeMapped() << "\n"; // Ranks Renumbered by Node
+        std::cout << std::left << std::setw( 20 ) << "Halo Surface"
+                  << ": " << std::setw( 8 ) << stats.halo_cells << "\n"; // Cells Across Every Rank Boundary per Halo Layer
+        std::cout << std::left << std::setw( 20 ) << "Max Rank Surface"
+                  << ": " << std::setw( 8 ) << stats.max_halo_cells << "\n"; // Most Cells One Rank Exchanges per Halo Layer
+        std::cout << std::left << std::setw( 20 ) << "On-Node Pairs"
+                  << ": " << stats.node_pairs << " of " << stats.pairs << "\n"; // Neighbor Pairs Sharing a Node
+    }
+
+    // Hilbert: Report the Surface Equal Segments of the Hilbert Curve Through the Cells Would Have - the Solver Still Runs on the Blocks
+    if ( !cl.decomposition.compare( "hilbert" ) ) {
+        ExaCLAMR::CurvePartition     curve( cl.global_num_cells, cl.halo_size, cl.periodic, decomposition.comm() );
+        ExaCLAMR::DecompositionStats curve_stats = curve.stats( decomposition.nodeIds() );
+
+        if ( rank == 0 ) {
+            std::cout << std::left << std::setw( 20 ) << "Curve Mapped"
+                      << ": " << std::setw( 8 ) << decomposition.curveMapped() << "\n"; // Ranks Numbered Along the Curve
+            std::cout << std::left << std::setw( 20 ) << "Curve Halo Surface"
+                      << ": " << std::setw( 8 ) << curve_stats.halo_cells << "\n"; // Faces Between Curve Segments
+            std::cout << std::left << std::setw( 20 ) << "Curve Max Surface"
+                      << ": " << std::setw( 8 ) << curve_stats.max_halo_cells << "\n"; // Most Faces One Segment Exchanges
+            std::cout << std::left << std::setw( 20 ) << "Curve On-Node Pairs"
+                      << ": " << curve_stats.node_pairs << " of " << curve_stats.pairs << "\n"; // Segment Pairs Sharing a Node
+        }
     }
-    int y_ranks = comm_size / x_ranks;
-    if ( DEBUG ) std::cout << "X Ranks: " << x_ranks << " Y Ranks: " << y_ranks << "\n";
 
-    std::array<int, 3> ranks_per_dim = { x_ranks, y_ranks, 1 }; // Ranks per Dimension
+    if ( rank == 0 ) std::cout << "====================================\n";
 
-    Cajita::ManualPartitioner partitioner( ranks_per_dim ); // Create Cajita Partitioner
+    Cajita::ManualPartitioner partitioner = decomposition.partitioner(); // Create Cajita Partitioner
 
     // Create Solver
     if ( !cl.meshtype.compare( "regular" ) ) {
-        auto solver = ExaCLAMR::createRegularSolver( cl, bc, MPI_COMM_WORLD, MeshInitFunc<state_t>( cl.global_bounding_box ), partitioner, timer );
+        auto solver = ExaCLAMR::createRegularSolver( cl, bc, decomposition.comm(), MeshInitFunc<state_t>( cl.global_bounding_box ), partitioner, timer );
         timer.setupStop();
         // Solve
         solver->solve( cl.write_freq, timer );
-    } else if ( !cl.meshtype.compare( "amr" ) )
-        auto solver = ExaCLAMR::createAMRSolver( cl, bc, MPI_COMM_WORLD, MeshInitFunc<state_t>( cl.global_bounding_box ), partitioner, timer );
-    else
-        auto solver = ExaCLAMR::createRegularSolver( cl, bc, MPI_COMM_WORLD, MeshInitFunc<state_t>( cl.global_bounding_box ), partitioner, timer );
+    } else if ( !cl.meshtype.compare( "amr" ) ) {
+        auto solver = ExaCLAMR::createAMRSolver( cl, bc, decomposition.comm(), MeshInitFunc<state_t>( cl.global_bounding_box ), partitioner, timer );
+        timer.setupStop();
+        // Solve
+        solver->solve( cl.write_freq, timer );
+    } else
+        auto solver = ExaCLAMR::createRegularSolver( cl, bc, decomposition.comm(), MeshInitFunc<state_t>( cl.global_bounding_box ), partitioner, timer );
 };
 
 int main( int argc, char *argv[] ) {
@@ -119,7 +154,7 @@ int main( int argc, char *argv[] ) {
 
     timer.setupStart();
 
-    // Using doubles
+    // Parse Input in Double Precision - Converted to the Requested Precision Below
     using state_t = double;
 
     MPI_Init( &argc, &argv );         // Initialize MPI
@@ -155,8 +190,41 @@ int main( int argc, char *argv[] ) {
                   << ": " << std::setw( 8 ) << cl.device << "\n"; // Threading Setting
         std::cout << std::left << std::setw( 20 ) << "Mesh Type"
                   << ": " << std::setw( 8 ) << cl.meshtype << "\n"; // Mesh Type
+        if ( !cl.meshtype.compare( "amr" ) )
+            std::cout << std::left << std::setw( 20 ) << "AMR Levels"
+                      << ": " << std::setw( 8 ) << cl.amr_levels << "\n"; // AMR Refinement Levels
         std::cout << std::left << std::setw( 20 ) << "Ordering"
                   << ": " << std::setw( 8 ) << cl.ordering << "\n"; // Ordering
+        if ( !cl.ordering.compare( "tiled" ) )
+            std::cout << std::left << std::setw( 20 ) << "Layout Tile"
+                      << ": " << EXACLAMR_LAYOUT_TILE << "x" << EXACLAMR_LAYOUT_TILE << "\n"; // Layout Tile Size
+        if ( !cl.ordering.compare( "aosoa" ) )
+            std::cout << std::left << std::setw( 20 ) << "AoSoA Vector"
+                      << ": " << EXACLAMR_AOSOA_VECTOR << "\n"; // Interleaved Cell State Vector Length
+        std::cout << std::left << std::setw( 20 ) << "Traversal"
+                  << ": " << std::setw( 8 ) << cl.traversal << "\n"; // Cell Traversal
+        std::cout << std::left << std::setw( 20 ) << "Kernel"
+                  << ": " << std::setw( 8 ) << cl.kernel << "\n"; // Finite Volume Kernel
+        if ( !cl.kernel.compare( "tiled" ) )
+            std::cout << std::left << std::setw( 20 ) << "Tile Size"
+                      << ": " << cl.tile[0] << "x" << cl.tile[1] << "\n"; // Tile Size
+        std::cout << std::left << std::setw( 20 ) << "Precision"
+                  << ": " << std::setw( 8 ) << cl.precision << "\n"; // Precision
+        std::cout << std::left << std::setw( 20 ) << "Time Step"
+                  << ": " << std::setw( 8 ) << cl.timestep << "\n"; // Time Step Calculation
+        if ( !cl.timestep.compare( "lagged" ) )
+            std::cout << std::left << std::setw( 20 ) << "Safety Factor"
+                      << ": " << std::setw( 8 ) << cl.safety << "\n"; // Lagged Time Step Safety Factor
+        std::cout << std::left << std::setw( 20 ) << "Exchange Interval"
+                  << ": " << std::setw( 8 ) << cl.exchange_interval << "\n"; // Halo Exchange Interval
+        std::cout << std::left << std::setw( 20 ) << "Halo Exchange"
+                  << ": " << std::setw( 8 ) << cl.exchange << "\n"; // Halo Exchange
+        std::cout << std::left << std::setw( 20 ) << "Halo Transport"
+                  << ": " << std::setw( 8 ) << cl.transport << "\n"; // Halo Transport
+        std::cout << std::left << std::setw( 20 ) << "Decomposition"
+                  << ": " << std::setw( 8 ) << cl.decomposition << "\n"; // Rank Decomposition
+        std::cout << std::left << std::setw( 20 ) << "Rebalance Interval"
+                  << ": " << std::setw( 8 ) << cl.rebalance_interval << "\n"; // Rebalance Interval
         std::cout << std::left << std::setw( 20 ) << "Cells"
                   << ": " << std::setw( 8 ) << cl.nx << std::setw( 8 ) << cl.ny << std::setw( 8 ) << cl.nz << "\n"; // Number of Cells
         std::cout << std::left << std::setw( 20 ) << "Domain"
@@ -177,7 +245,13 @@ int main( int argc, char *argv[] ) {
     timer.writeStop();
 
     // Call Clamr - Double or Float as Template Arg
-    clamr<state_t>( cl, bc, timer );
+    // Mixed Precision Runs the Double Solver with Float Storage
+    if ( !cl.precision.compare( "float" ) ) {
+        ExaCLAMR::ClArgs<float> cl_float = ExaCLAMR::convertClArgs<float>( cl );
+        clamr<float>( cl_float, bc, timer );
+    } else {
+        clamr<state_t>( cl, bc, timer );
+    }
 
     Kokkos::finalize(); // Finalize Kokkos
     MPI_Finalize();     // Finalize MPI
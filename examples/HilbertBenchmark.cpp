@@ -0,0 +1,101 @@
+/**
+ * @file
+ * @author Patrick Bridges <pbridges@unm.edu>
+ * @author Jered Dominguez-Trujillo <jereddt@unm.edu>
+ *
+ * @section DESCRIPTION
+ * Benchmark of Hilbert index computation for the access pattern of the finite volume stencil
+ * Each cell reads its own index, its neighbors one and two cells away along each dimension and its diagonal neighbors
+ * Compares the bit-by-bit loop, the table-driven state machine, a precomputed offset per cell and cursor stepping
+ */
+
+// Include Statements
+#include <SpaceFillingCurve.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <stdlib.h>
+#include <string>
+
+// Cells the Stencil Reads: Every Offset ( di, dj ) with |di| + |dj| <= 2
+static const int num_offsets = 13;
+
+// Time a Sum of the Indices of Every Stencil Cell Over the Interior, Repeated
+template <class IndexFunc>
+void benchmark( const std::string &name, const long side, const int repetitions, const IndexFunc &index ) {
+    long sum   = 0;
+    auto start = std::chrono::high_resolution_clock::now();
+    for ( int r = 0; r < repetitions; r++ ) {
+        long rep_sum = 0;
+        Kokkos::parallel_reduce(
+            "Hilbert_Benchmark", Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>( 0, ( side - 4 ) * ( side - 4 ) ), KOKKOS_LAMBDA( const long n, long &lsum ) {
+                long i = 2 + n / ( side - 4 ), j = 2 + n % ( side - 4 );
+                lsum += index( i, j );
+            },
+            rep_sum );
+        sum += rep_sum;
+    }
+    auto stop = std::chrono::high_resolution_clock::now();
+
+    double seconds = std::chrono::duration<double>( stop - start ).count();
+    double cells   = (double)( side - 4 ) * ( side - 4 ) * repetitions;
+    std::cout << std::left << std::setw( 12 ) << name << std::setw( 16 ) << seconds * 1.0e9 / cells << std::setw( 24 ) << seconds * 1.0e9 / ( cells * num_offsets ) << sum << "\n";
+}
+
+int main( int argc, char *argv[] ) {
+    Kokkos::initialize( argc, argv );
+    {
+        // Mesh Side and Repetitions
+        long side        = ( argc > 1 ) ? atol( argv[1] ) : 512;
+        int  repetitions = ( argc > 2 ) ? atoi( argv[2] ) : 10;
+
+        side = ExaCLAMR::SpaceFillingCurve::coveringSide( side, side );
+        if ( side < 8 ) side = 8;
+
+        std::cout << "Hilbert Index Benchmark: " << side << " x " << side << " Cells, " << repetitions << " Repetitions\n";
+        std::cout << std::left << std::setw( 12 ) << "Method" << std::setw( 16 ) << "ns / Cell" << std::setw( 24 ) << "ns / Index" << "Checksum\n";
+
+        ExaCLAMR::SpaceFillingCurve::HilbertTable<Kokkos::HostSpace>   table( side );
+        ExaCLAMR::SpaceFillingCurve::HilbertOffsets<Kokkos::HostSpace> offsets( Kokkos::DefaultHostExecutionSpace(), side, side );
+
+        // Bit-by-Bit Loop for Every Cell Read
+        benchmark( "loop", side, repetitions, KOKKOS_LAMBDA( const long i, const long j ) {
+            long sum = 0;
+            for ( int di = -2; di <= 2; di++ )
+                for ( int dj = abs( di ) - 2; dj <= 2 - abs( di ); dj++ ) sum += ExaCLAMR::SpaceFillingCurve::hilbertIndex( side, i + di, j + dj );
+            return sum;
+        } );
+
+        // Table-Driven State Machine for Every Cell Read
+        benchmark( "table", side, repetitions, KOKKOS_LAMBDA( const long i, const long j ) {
+            long sum = 0;
+            for ( int di = -2; di <= 2; di++ )
+                for ( int dj = abs( di ) - 2; dj <= 2 - abs( di ); dj++ ) sum += table.index( i + di, j + dj );
+            return sum;
+        } );
+
+        // Precomputed Offset of Every Cell
+        benchmark( "offsets", side, repetitions, KOKKOS_LAMBDA( const long i, const long j ) {
+            long sum = 0;
+            for ( int di = -2; di <= 2; di++ )
+                for ( int dj = abs( di ) - 2; dj <= 2 - abs( di ); dj++ ) sum += offsets( i + di, j + dj );
+            return sum;
+        } );
+
+        // One Cursor per Cell, Neighbors Stepped from It
+        benchmark( "cursor", side, repetitions, KOKKOS_LAMBDA( const long i, const long j ) {
+            ExaCLAMR::SpaceFillingCurve::HilbertCursor c = table.cursor( i, j );
+
+            long sum = 0;
+            for ( int di = -2; di <= 2; di++ )
+                for ( int dj = abs( di ) - 2; dj <= 2 - abs( di ); dj++ ) sum += table.neighbor( c, i, j, di, dj );
+            return sum;
+        } );
+    }
+    Kokkos::finalize();
+
+    return 0;
+};
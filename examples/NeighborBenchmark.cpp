@@ -0,0 +1,116 @@
+/**
+ * @file
+ * @author Patrick Bridges <pbridges@unm.edu>
+ * @author Jered Dominguez-Trujillo <jereddt@unm.edu>
+ *
+ * @section DESCRIPTION
+ * Benchmark of neighbor finding for the cells of an AMR mesh
+ * The mesh is refined to the finest level along a circular front, as around a dam break
+ * Compares the perfect hash over the finest level and the compact open-addressing hash with a search of sorted keys
+ */
+
+// Include Statements
+#include <Neighbors.hpp>
+#include <SpaceFillingCurve.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <math.h>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+// Refine a Cell and its Children Wherever they Cross the Front, Children in Z Order
+void refine( const int i, const int j, const int level, const int levels, const double side, std::vector<int> &cells ) {
+    double width  = 1.0 / ( 1 << level );
+    double radius = 0.25 * side;
+
+    // Nearest and Farthest Point of the Cell from the Center of the Domain
+    double near = 0.0, far = 0.0;
+    for ( int dim = 0; dim < 2; dim++ ) {
+        double low = ( dim == 0 ? i : j ) * width - 0.5 * side, high = low + width;
+        double d   = ( low > 0.0 ) ? low : ( ( high < 0.0 ) ? -high : 0.0 );
+        double e   = ( -low > high ) ? -low : high;
+        near += d * d;
+        far += e * e;
+    }
+
+    if ( level < levels && sqrt( near ) <= radius && sqrt( far ) >= radius ) {
+        for ( int c = 0; c < 4; c++ ) refine( 2 * i + ( c & 1 ), 2 * j + ( c >> 1 ), level + 1, levels, side, cells );
+    } else {
+        cells.push_back( i );
+        cells.push_back( j );
+        cells.push_back( level );
+    }
+}
+
+// Time Neighbor Finding of Every Cell, Repeated, and Count Neighbors Differing from a Reference
+template <class ViewType>
+void benchmark( const std::string &name, const int type, const int coarse, const int levels, const int repetitions, const ViewType &i_cell, const ViewType &j_cell, const ViewType &level,
+                Kokkos::View<int *[4], Kokkos::HostSpace> &reference ) {
+    int size = i_cell.extent( 0 );
+
+    ExaCLAMR::Neighbors<Kokkos::HostSpace> neighbors( type, { coarse, coarse }, levels );
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for ( int r = 0; r < repetitions; r++ ) neighbors.build( Kokkos::DefaultHostExecutionSpace(), i_cell, j_cell, level, size );
+    Kokkos::fence();
+    auto stop = std::chrono::high_resolution_clock::now();
+
+    // Every Variant Must Find the Same Neighbors
+    auto result = neighbors.view();
+    if ( reference.extent( 0 ) == 0 ) {
+        reference = Kokkos::View<int *[4], Kokkos::HostSpace>( "reference", size );
+        Kokkos::deep_copy( reference, result );
+    }
+
+    long mismatches = 0, sum = 0;
+    for ( int n = 0; n < size; n++ ) {
+        for ( int side = 0; side < 4; side++ ) {
+            if ( result( n, side ) != reference( n, side ) ) mismatches++;
+            sum += result( n, side );
+        }
+    }
+
+    double seconds = std::chrono::duration<double>( stop - start ).count();
+    std::cout << std::left << std::setw( 12 ) << name << std::setw( 16 ) << seconds * 1.0e9 / ( (double)size * repetitions ) << std::setw( 16 ) << mismatches << sum << "\n";
+}
+
+int main( int argc, char *argv[] ) {
+    Kokkos::initialize( argc, argv );
+    {
+        // Coarse Cells per Side, Refinement Levels and Repetitions
+        int coarse      = ( argc > 1 ) ? atoi( argv[1] ) : 128;
+        int levels      = ( argc > 2 ) ? atoi( argv[2] ) : 4;
+        int repetitions = ( argc > 3 ) ? atoi( argv[3] ) : 10;
+
+        // Coarse Cells Along a Hilbert Curve, Each Refined Along the Front
+        std::vector<int> cells;
+        for ( auto &c : ExaCLAMR::SpaceFillingCurve::hilbertCells( coarse, coarse ) ) refine( c[0], c[1], 0, levels, coarse, cells );
+
+        int size = cells.size() / 3;
+
+        Kokkos::View<int *, Kokkos::HostSpace> i_cell( "i", size ), j_cell( "j", size ), level( "level", size );
+        for ( int n = 0; n < size; n++ ) {
+            i_cell( n ) = cells[3 * n];
+            j_cell( n ) = cells[3 * n + 1];
+            level( n )  = cells[3 * n + 2];
+        }
+
+        long fine = ( (long)coarse * coarse ) << ( 2 * levels );
+        std::cout << "Neighbor Finding Benchmark: " << size << " Cells of " << fine << " at the Finest Level, " << repetitions << " Repetitions\n";
+        std::cout << std::left << std::setw( 12 ) << "Method" << std::setw( 16 ) << "ns / Cell" << std::setw( 16 ) << "Mismatches" << "Checksum\n";
+
+        Kokkos::View<int *[4], Kokkos::HostSpace> reference;
+
+        benchmark( "sort", ExaCLAMR::NeighborType::SORT, coarse, levels, repetitions, i_cell, j_cell, level, reference );
+        benchmark( "perfect", ExaCLAMR::NeighborType::PERFECT, coarse, levels, repetitions, i_cell, j_cell, level, reference );
+        benchmark( "compact", ExaCLAMR::NeighborType::COMPACT, coarse, levels, repetitions, i_cell, j_cell, level, reference );
+    }
+    Kokkos::finalize();
+
+    return 0;
+};
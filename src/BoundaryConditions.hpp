@@ -19,6 +19,8 @@
 
 #include <Kokkos_Core.hpp>
 
+#include <iostream>
+
 namespace ExaCLAMR {
     /**
  * @struct BoundaryType
@@ -31,81 +33,167 @@ namespace ExaCLAMR {
         };
     };
 
+    /**
+ * Compile-Time Boundary Type Tags
+ * Boundary policies are sets of these tags, one per face, so the boundary kernels carry no boundary type branches
+ */
+    namespace Boundary {
+        struct None {};       /**< No boundary condition - boundary cells are left untouched */
+        struct Reflective {}; /**< Reflective ( no flux ) boundary */
+    } // namespace Boundary
+
+    /**
+ * Reflective ( No Flux ) Boundary Condition for a Single Boundary Cell
+ * @param i Index in x-direction
+ * @param j Index in y-direction
+ * @param k Index in z-direction
+ * @param h_current Height view
+ * @param u_current Momentum view
+ * @tparam Dim Dimension normal to the boundary
+ * @tparam Side Side of the domain the boundary lies on ( -1 lower or +1 upper )
+ **/
+    template <int Dim, int Side, class ArrayType>
+    KOKKOS_INLINE_FUNCTION void reflect( const int i, const int j, const int k, const ArrayType &h_current, const ArrayType &u_current ) {
+        // Offsets from the Boundary Cell Toward the Domain
+        constexpr int di = ( Dim == 0 ) ? -Side : 0;
+        constexpr int dj = ( Dim == 1 ) ? -Side : 0;
+
+        // No Flux Boundary Condition - Normal Momentum is Reflected
+        h_current( i, j, k, 0 ) = h_current( i + di, j + dj, k, 0 );
+        u_current( i, j, k, 0 ) = ( Dim == 0 ) ? -u_current( i + di, j + dj, k, 0 ) : u_current( i + di, j + dj, k, 0 );
+        u_current( i, j, k, 1 ) = ( Dim == 1 ) ? -u_current( i + di, j + dj, k, 1 ) : u_current( i + di, j + dj, k, 1 );
+
+        // Second Boundary Node set to 0
+        h_current( i - di, j - dj, k, 0 ) = 0;
+        u_current( i - di, j - dj, k, 0 ) = 0;
+        u_current( i - di, j - dj, k, 1 ) = 0;
+    }
+
+    /**
+ * Face Without a Boundary Condition Launches Nothing
+ **/
+    template <int Dim, int Side, class ExecutionSpace, class MeshType, class ArrayType>
+    void applyBoundary( Boundary::None, const ExecutionSpace &, const MeshType &, const ArrayType &, const ArrayType &, const int ) {}
+
+    /**
+ * Apply a Reflective Boundary Condition with a 1-D Kernel over the Boundary Strip of a Face Owned by this Rank
+ * Ranks that do not own the face launch nothing
+ * No fence is issued - kernels on the same execution space are ordered with later kernels
+ * @param exec_space Execution space
+ * @param mesh Mesh
+ * @param h_current Height view
+ * @param u_current Momentum view
+ * @param depth Number of redundant ghost cells the strip extends along the boundary
+ * @tparam Dim Dimension normal to the boundary
+ * @tparam Side Side of the domain the boundary lies on ( -1 lower or +1 upper )
+ **/
+    template <int Dim, int Side, class ExecutionSpace, class MeshType, class ArrayType>
+    void applyBoundary( Boundary::Reflective, const ExecutionSpace &exec_space, const MeshType &mesh, const ArrayType &h_current, const ArrayType &u_current, const int depth ) {
+        auto strip = mesh.boundarySpace( ( Side < 0 ) ? Dim : Dim + 3, depth );
+        if ( strip.size() == 0 ) return;
+
+        // DEBUG: Print Rank and Boundary Strip
+        if ( DEBUG ) std::cout << "Rank: " << mesh.rank() << "\tBoundary: " << ( ( Side < 0 ) ? Dim : Dim + 3 ) << "\tStrip: " << strip.min( 0 ) << " " << strip.min( 1 ) << " " << strip.max( 0 ) << " " << strip.max( 1 ) << "\n";
+
+        // Loop Along the Boundary ( Tangential Direction )
+        constexpr int tdim = 1 - Dim;
+        long          kmin = strip.min( 2 ), kmax = strip.max( 2 );
+        long          bmin = strip.min( Dim );
+
+        Kokkos::parallel_for(
+            "Boundary_Conditions", Kokkos::RangePolicy<ExecutionSpace>( exec_space, strip.min( tdim ), strip.max( tdim ) ), KOKKOS_LAMBDA( const int n ) {
+                int i = ( Dim == 0 ) ? bmin : n;
+                int j = ( Dim == 0 ) ? n : bmin;
+                for ( int k = kmin; k < kmax; k++ ) reflect<Dim, Side>( i, j, k, h_current, u_current );
+            } );
+    }
+
     /**
  * @struct BoundaryCondition
- * @brief Struct that applies the specified boundary conditions with a Kokkos Inline Function
+ * @brief Struct that holds the boundary type of each face, chosen at runtime, and applies them over the physical boundary strips owned by a rank
+ * Boundary types are checked once per face on the host - the kernels themselves are specialized on the face and boundary type
  */
     struct BoundaryCondition {
-        template <class ProblemManagerType, class ArrayType, class MeshType>
-        KOKKOS_INLINE_FUNCTION void operator()( const ProblemManagerType &pm, const int i, const int j, const int k, ArrayType &h_current, ArrayType &u_current, MeshType &mesh ) const {
-            // Left Boundary
-            if ( mesh.isBottomBoundary( i, j, k ) ) {
-                // DEBUG: Print Rank and Bottom Boundary Indices
-                // if ( DEBUG ) std::cout << "Rank: " << pm.mesh()->rank() << "\tBottom Boundary:\ti: " << i << "\tj: " << j << "\tk: " << k << "\n";
-                if ( boundary_type[1] == BoundaryType::REFLECTIVE ) {
-                    // No Flux Boundary Condition
-                    h_current( i, j, k, 0 ) = h_current( i, j + 1, k, 0 );
-                    u_current( i, j, k, 0 ) = u_current( i, j + 1, k, 0 );
-                    u_current( i, j, k, 1 ) = -u_current( i, j + 1, k, 1 );
-                    // Second Boundary Node set to 0
-                    h_current( i, j - 1, k, 0 ) = 0;
-                    u_current( i, j - 1, k, 0 ) = 0;
-                    u_current( i, j - 1, k, 1 ) = 0;
-                }
-            }
+        /**
+         * Apply Boundary Conditions to Every Face
+         * Shallow Water Solver is 2-D - Only X and Y Boundaries
+         * @param exec_space Execution space
+         * @param mesh Mesh
+         * @param h_current Height view
+         * @param u_current Momentum view
+         * @param depth Number of redundant ghost cells the boundaries extend along
+         **/
+        template <class ExecutionSpace, class MeshType, class ArrayType>
+        void apply( const ExecutionSpace &exec_space, const MeshType &mesh, const ArrayType &h_current, const ArrayType &u_current, const int depth ) const {
+            applyFace<0, -1>( boundary_type[0], exec_space, mesh, h_current, u_current, depth ); // X - Left
+            applyFace<1, -1>( boundary_type[1], exec_space, mesh, h_current, u_current, depth ); // Y - Bottom
+            applyFace<0, 1>( boundary_type[3], exec_space, mesh, h_current, u_current, depth );  // X - Right
+            applyFace<1, 1>( boundary_type[4], exec_space, mesh, h_current, u_current, depth );  // Y - Top
+        }
 
-            // Top Boundary
-            if ( mesh.isTopBoundary( i, j, k ) ) {
-                // DEBUG: Print Rank and Top Boundary Indices
-                // if ( DEBUG ) std::cout << "Rank: " << pm.mesh()->rank() << "\tTop Boundary:\ti: " << i << "\tj: " << j << "\tk: " << k << "\n";
-                if ( boundary_type[4] == BoundaryType::REFLECTIVE ) {
-                    // No Flux Boundary Condition
-                    h_current( i, j, k, 0 ) = h_current( i, j - 1, k, 0 );
-                    u_current( i, j, k, 0 ) = u_current( i, j - 1, k, 0 );
-                    u_current( i, j, k, 1 ) = -u_current( i, j - 1, k, 1 );
-                    // Second Boundary Node set to 0
-                    h_current( i, j + 1, k, 0 ) = 0;
-                    u_current( i, j + 1, k, 0 ) = 0;
-                    u_current( i, j + 1, k, 1 ) = 0;
-                }
-            }
+        /**
+         * Whether Every X and Y Face has the Given Boundary Type
+         * @param type Boundary type
+         **/
+        bool uniform( const int type ) const {
+            return boundary_type[0] == type && boundary_type[1] == type && boundary_type[3] == type && boundary_type[4] == type;
+        }
 
-            // Right Boundary
-            if ( mesh.isRightBoundary( i, j, k ) ) {
-                // DEBUG: Print Rank and Right Boundary Indices
-                // if ( DEBUG ) std::cout << "Rank: " << pm.mesh()->rank() << "\tRight Boundary:\ti: " << i << "\tj: " << j << "\tk: " << k << "\n";
-                if ( boundary_type[3] == BoundaryType::REFLECTIVE ) {
-                    // No Flux Boundary Condition
-                    h_current( i, j, k, 0 ) = h_current( i - 1, j, k, 0 );
-                    u_current( i, j, k, 0 ) = -u_current( i - 1, j, k, 0 );
-                    u_current( i, j, k, 1 ) = u_current( i - 1, j, k, 1 );
-                    // Second Boundary Node set to 0
-                    h_current( i + 1, j, k, 0 ) = 0;
-                    u_current( i + 1, j, k, 0 ) = 0;
-                    u_current( i + 1, j, k, 1 ) = 0;
-                }
-            }
+        Kokkos::Array<int, 6> boundary_type; /**< Boundary condition type on all 6 walls ( 3-D ) */
 
-            // Left Boundary
-            if ( mesh.isLeftBoundary( i, j, k ) ) {
-                // DEBUG: Print Rank and Left Boundary Indices
-                // if ( DEBUG ) std::cout << "Rank: " << pm.mesh()->rank() << "\tLeft Boundary:\ti: " << i << "\tj: " << j << "\tk: " << k << "\n";
-                if ( boundary_type[0] == BoundaryType::REFLECTIVE ) {
-                    // No Flux Boundary Condition
-                    h_current( i, j, k, 0 ) = h_current( i + 1, j, k, 0 );
-                    u_current( i, j, k, 0 ) = -u_current( i + 1, j, k, 0 );
-                    u_current( i, j, k, 1 ) = u_current( i + 1, j, k, 1 );
-                    // Second Boundary Node set to 0
-                    h_current( i - 1, j, k, 0 ) = 0;
-                    u_current( i - 1, j, k, 0 ) = 0;
-                    u_current( i - 1, j, k, 1 ) = 0;
-                }
+      private:
+        /**
+         * Apply the Boundary Condition of a Single Face
+         * @param type Boundary type of the face
+         **/
+        template <int Dim, int Side, class ExecutionSpace, class MeshType, class ArrayType>
+        static void applyFace( const int type, const ExecutionSpace &exec_space, const MeshType &mesh, const ArrayType &h_current, const ArrayType &u_current, const int depth ) {
+            switch ( type ) {
+            case BoundaryType::REFLECTIVE:
+                applyBoundary<Dim, Side>( Boundary::Reflective(), exec_space, mesh, h_current, u_current, depth );
+                break;
+            default:
+                applyBoundary<Dim, Side>( Boundary::None(), exec_space, mesh, h_current, u_current, depth );
+                break;
             }
         }
+    };
 
-        Kokkos::Array<int, 6> boundary_type; /**< Boundary condition type on all 6 walls ( 3-D ) */
+    /**
+ * @struct BoundaryPolicy
+ * @brief Compile-time set of boundary types, one tag per face
+ * Faces tagged Boundary::None compile away entirely
+ */
+    template <class Left, class Bottom, class Right, class Top>
+    struct BoundaryPolicy {
+        BoundaryPolicy() = default;
+
+        /**
+         * Constructor
+         * Boundary types are fixed by the template arguments - the runtime boundary conditions are only checked by the solver factory
+         **/
+        explicit BoundaryPolicy( const BoundaryCondition & ) {}
+
+        /**
+         * Apply Boundary Conditions to Every Face
+         * @param exec_space Execution space
+         * @param mesh Mesh
+         * @param h_current Height view
+         * @param u_current Momentum view
+         * @param depth Number of redundant ghost cells the boundaries extend along
+         **/
+        template <class ExecutionSpace, class MeshType, class ArrayType>
+        void apply( const ExecutionSpace &exec_space, const MeshType &mesh, const ArrayType &h_current, const ArrayType &u_current, const int depth ) const {
+            applyBoundary<0, -1>( Left(), exec_space, mesh, h_current, u_current, depth );
+            applyBoundary<1, -1>( Bottom(), exec_space, mesh, h_current, u_current, depth );
+            applyBoundary<0, 1>( Right(), exec_space, mesh, h_current, u_current, depth );
+            applyBoundary<1, 1>( Top(), exec_space, mesh, h_current, u_current, depth );
+        }
     };
 
+    // Every X and Y Face Reflective ( Dam Break )
+    using ReflectiveBoundaries = BoundaryPolicy<Boundary::Reflective, Boundary::Reflective, Boundary::Reflective, Boundary::Reflective>;
+
 } // namespace ExaCLAMR
 
 #endif
\ No newline at end of file
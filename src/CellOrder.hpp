@@ -0,0 +1,190 @@
+/**
+ * @file
+ * @author Patrick Bridges <pbridges@unm.edu>
+ * @author Jered Dominguez-Trujillo <jereddt@unm.edu>
+ *
+ * @section DESCRIPTION
+ * Cell traversal in the order the state arrays store the cells
+ * With curve ( Hilbert, Morton ) or tiled layouts an MDRange over ( i, j, k ) jumps around memory
+ * Cells of an index space are instead sorted once by their offset in a state view and walked in that order,
+ * in contiguous chunks per thread, so each thread streams through a contiguous part of the arrays
+ */
+
+#ifndef EXACLAMR_CELLORDER_HPP
+#define EXACLAMR_CELLORDER_HPP
+
+#ifndef DEBUG
+#define DEBUG 0
+#endif
+
+// Include Statements
+#include <Cajita.hpp>
+#include <Kokkos_Core.hpp>
+
+#include <algorithm>
+#include <array>
+#include <map>
+#include <numeric>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace ExaCLAMR {
+
+    /**
+ * @struct TraversalType
+ * @brief Struct which contains enums of the cell traversal options
+ */
+    struct TraversalType {
+        enum Values {
+            INDEX   = 0,
+            STORAGE = 1
+        };
+    };
+
+    /**
+ * Whether a Layout Stores Cells in the Order an MDRange over ( i, j, k ) Visits Them
+ * True for row- and column-major layouts and for layouts whose cell offsets rise along the rows
+ */
+    template <class Layout>
+    struct LayoutRowMonotone : std::integral_constant<bool, std::is_same<Layout, Kokkos::LayoutRight>::value || std::is_same<Layout, Kokkos::LayoutLeft>::value> {};
+
+    /**
+ * The CellOrder Class
+ * @class CellOrder
+ * @brief Cells of index spaces sorted by their offset in a state view
+ * Views whose layout already stores cells in MDRange order are never sorted
+ **/
+    template <class ViewType>
+    class CellOrder {
+      public:
+        typedef typename ViewType::memory_space       memory_space;
+        typedef typename ViewType::array_layout       array_layout;
+        typedef Kokkos::View<int *[3], memory_space> cell_view;
+
+        /**
+         * Constructor
+         * @param view State view whose storage order the cells follow - every view the order is used with must share its layout and extents
+         * @param traversal Cell traversal type
+         */
+        CellOrder( const ViewType &view, const int traversal )
+            : _view( view ) {
+            bool strided = LayoutRowMonotone<array_layout>::value;
+            _enabled     = ( traversal == TraversalType::STORAGE ) && !strided;
+        };
+
+        /**
+         * Whether Kernels Walk the Cells in Storage Order
+         **/
+        bool enabled() const {
+            return _enabled;
+        };
+
+        /**
+         * Cells of an Index Space in Storage Order
+         * Sorted on first use and kept for later kernels over the same index space
+         * @param exec_space Execution space
+         * @param space Index space
+         * @return Indices ( i, j, k ) of the cells in storage order
+         **/
+        template <class ExecutionSpace>
+        cell_view cells( const ExecutionSpace &exec_space, const Cajita::IndexSpace<3> &space ) const {
+            std::array<long, 6> key = { space.min( 0 ), space.min( 1 ), space.min( 2 ), space.max( 0 ), space.max( 1 ), space.max( 2 ) };
+
+            auto cached = _cells.find( key );
+            if ( cached != _cells.end() ) return cached->second;
+
+            long size = space.size();
+            long n1 = space.extent( 1 ), n2 = space.extent( 2 );
+            long min0 = space.min( 0 ), min1 = space.min( 1 ), min2 = space.min( 2 );
+
+            // Offset of the First Component of Every Cell
+            Kokkos::View<long *, memory_space> offsets( Kokkos::ViewAllocateWithoutInitializing( "cell_offsets" ), size );
+            ViewType                           view = _view;
+            Kokkos::parallel_for(
+                "Cell_Offsets", Kokkos::RangePolicy<ExecutionSpace>( exec_space, 0, size ), KOKKOS_LAMBDA( const long n ) {
+                    long i = min0 + n / ( n1 * n2 ), j = min1 + ( n / n2 ) % n1, k = min2 + n % n2;
+                    offsets( n ) = &view( i, j, k, 0 ) - view.data();
+                } );
+
+            auto h_offsets = Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(), offsets );
+
+            // Sort Cells by Offset on the Host - Once per Index Space
+            std::vector<long> order( size );
+            std::iota( order.begin(), order.end(), 0 );
+            std::sort( order.begin(), order.end(), [&]( const long a, const long b ) { return h_offsets( a ) < h_offsets( b ); } );
+
+            cell_view cells( Kokkos::ViewAllocateWithoutInitializing( "cell_order" ), size );
+            auto      h_cells = Kokkos::create_mirror_view( cells );
+            for ( long m = 0; m < size; m++ ) {
+                long n          = order[m];
+                h_cells( m, 0 ) = min0 + n / ( n1 * n2 );
+                h_cells( m, 1 ) = min1 + ( n / n2 ) % n1;
+                h_cells( m, 2 ) = min2 + n % n2;
+            }
+            Kokkos::deep_copy( cells, h_cells );
+
+            _cells[key] = cells;
+            return cells;
+        };
+
+      private:
+        ViewType                                         _view;    /**< State view the cells are sorted by */
+        bool                                             _enabled; /**< Kernels walk the cells in storage order */
+        mutable std::map<std::array<long, 6>, cell_view> _cells;   /**< Sorted cells of each index space used so far */
+    };
+
+    /**
+ * Parallel For over the Cells of an Index Space
+ * Walks the cells in storage order when the order is enabled, otherwise an MDRange over ( i, j, k )
+ * Storage order is split into one contiguous chunk per thread
+ * @param label Kernel label
+ * @param order Cell order of the state views
+ * @param space Index space
+ * @param exec_space Execution space
+ * @param functor Functor of ( i, j, k )
+ **/
+    template <class OrderType, class ExecutionSpace, class Functor>
+    void cellFor( const std::string &label, const OrderType &order, const Cajita::IndexSpace<3> &space, const ExecutionSpace &exec_space, const Functor &functor ) {
+        if ( !order.enabled() ) {
+            Kokkos::parallel_for( label, Cajita::createExecutionPolicy( space, exec_space ), functor );
+            return;
+        }
+
+        auto cells = order.cells( exec_space, space );
+        Kokkos::parallel_for(
+            label, Kokkos::RangePolicy<ExecutionSpace, Kokkos::Schedule<Kokkos::Static>>( exec_space, 0, cells.extent( 0 ) ), KOKKOS_LAMBDA( const long n ) {
+                functor( cells( n, 0 ), cells( n, 1 ), cells( n, 2 ) );
+            } );
+    }
+
+    /**
+ * Parallel Reduce over the Cells of an Index Space
+ * Walks the cells in storage order when the order is enabled, otherwise an MDRange over ( i, j, k )
+ * @param label Kernel label
+ * @param order Cell order of the state views
+ * @param space Index space
+ * @param exec_space Execution space
+ * @param functor Functor of ( i, j, k, value )
+ * @param reducer Kokkos reducer
+ **/
+    template <class OrderType, class ExecutionSpace, class Functor, class Reducer>
+    void cellReduce( const std::string &label, const OrderType &order, const Cajita::IndexSpace<3> &space, const ExecutionSpace &exec_space, const Functor &functor, const Reducer &reducer ) {
+        if ( !order.enabled() ) {
+            Kokkos::parallel_reduce( label, Cajita::createExecutionPolicy( space, exec_space ), functor, reducer );
+            return;
+        }
+
+        typedef typename Reducer::value_type value_type;
+
+        auto cells = order.cells( exec_space, space );
+        Kokkos::parallel_reduce(
+            label, Kokkos::RangePolicy<ExecutionSpace, Kokkos::Schedule<Kokkos::Static>>( exec_space, 0, cells.extent( 0 ) ), KOKKOS_LAMBDA( const long n, value_type &lval ) {
+                functor( cells( n, 0 ), cells( n, 1 ), cells( n, 2 ), lval );
+            },
+            reducer );
+    }
+
+} // namespace ExaCLAMR
+
+#endif
@@ -0,0 +1,370 @@
+/**
+ * @file
+ * @author Patrick Bridges <pbridges@unm.edu>
+ * @author Jered Dominguez-Trujillo <jereddt@unm.edu>
+ *
+ * @section DESCRIPTION
+ * Interleaved cell state storage, alongside the separate Cajita height and momentum arrays
+ * Height and momentum of one time level share a Cabana AoSoA: each SoA holds h, u and v of a run of consecutive cells
+ * Every cell a stencil reads then brings its height and momentum in with a single cache line
+ * The height and momentum views keep their ( i, j, k, component ) indexing through a Kokkos layout over the AoSoA
+ */
+
+#ifndef EXACLAMR_CELLSTATE_HPP
+#define EXACLAMR_CELLSTATE_HPP
+
+/**
+ * Cells per SoA of the interleaved cell state - a power of two, set at build time
+ */
+#ifndef EXACLAMR_AOSOA_VECTOR
+#define EXACLAMR_AOSOA_VECTOR 8
+#endif
+
+// Include Statements
+#include <CellOrder.hpp>
+
+#include <Cabana_Core.hpp>
+#include <Cajita.hpp>
+#include <Kokkos_Core.hpp>
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+namespace Kokkos {
+
+    /**
+ * @struct LayoutCellAoSoA
+ * @brief Array layout storing the cells of the first three indices in runs of Vector, with the components of a run interleaved
+ * Components are the fourth index - a view may cover only some of the components interleaved in its storage
+ */
+    template <unsigned Vector>
+    struct LayoutCellAoSoA {
+        static_assert( Vector > 0 && ( Vector & ( Vector - 1 ) ) == 0, "LayoutCellAoSoA vector length must be a power of two" );
+
+        typedef LayoutCellAoSoA array_layout;
+
+        enum : unsigned { vector_length = Vector };
+
+        size_t dimension[ARRAY_LAYOUT_MAX_RANK];
+        size_t components; /**< Components interleaved in each run - 0 for the fourth extent of the view */
+
+        enum { is_extent_constructible = true };
+
+        LayoutCellAoSoA( LayoutCellAoSoA const & ) = default;
+        LayoutCellAoSoA( LayoutCellAoSoA && )      = default;
+        LayoutCellAoSoA &operator=( LayoutCellAoSoA const & ) = default;
+        LayoutCellAoSoA &operator=( LayoutCellAoSoA && ) = default;
+
+        KOKKOS_INLINE_FUNCTION
+        explicit constexpr LayoutCellAoSoA( size_t N0 = 0, size_t N1 = 0, size_t N2 = 0, size_t N3 = 0, size_t N4 = 0, size_t N5 = 0, size_t N6 = 0, size_t N7 = 0 )
+            : dimension{ N0, N1, N2, N3, N4, N5, N6, N7 }
+            , components( 0 ) {}
+    };
+
+    namespace Impl {
+
+        /**
+ * Offset of the Interleaved Cell Layout
+ * Cells ( i, j, k ) are numbered row-major and grouped into runs of Vector cells
+ * Each run stores Vector values of its first component, then Vector values of the next, and so on
+ */
+        template <class Dimension, unsigned Vector>
+        struct ViewOffset<Dimension, Kokkos::LayoutCellAoSoA<Vector>, void> {
+            using is_mapping_plugin = std::true_type;
+            using is_regular        = std::false_type;
+
+            typedef size_t                          size_type;
+            typedef Dimension                       dimension_type;
+            typedef Kokkos::LayoutCellAoSoA<Vector> array_layout;
+
+            dimension_type m_dim;
+            size_type      m_run; /**< Span of a run of Vector cells with all interleaved components */
+
+            //----------------------------------------
+
+            template <typename I0>
+            KOKKOS_INLINE_FUNCTION size_type operator()( I0 const &i0 ) const {
+                return run( i0, 0 );
+            }
+
+            template <typename I0, typename I1>
+            KOKKOS_INLINE_FUNCTION size_type operator()( I0 const &i0, I1 const &i1 ) const {
+                return run( i0 * m_dim.N1 + i1, 0 );
+            }
+
+            template <typename I0, typename I1, typename I2>
+            KOKKOS_INLINE_FUNCTION size_type operator()( I0 const &i0, I1 const &i1, I2 const &i2 ) const {
+                return run( ( i0 * m_dim.N1 + i1 ) * m_dim.N2 + i2, 0 );
+            }
+
+            template <typename I0, typename I1, typename I2, typename I3>
+            KOKKOS_INLINE_FUNCTION size_type operator()( I0 const &i0, I1 const &i1, I2 const &i2, I3 const &i3 ) const {
+                return run( ( i0 * m_dim.N1 + i1 ) * m_dim.N2 + i2, i3 );
+            }
+
+            //----------------------------------------
+
+            KOKKOS_INLINE_FUNCTION array_layout layout() const {
+                array_layout l( m_dim.N0, m_dim.N1, m_dim.N2, m_dim.N3, m_dim.N4, m_dim.N5, m_dim.N6, m_dim.N7 );
+                l.components = m_run / Vector;
+                return l;
+            }
+
+            KOKKOS_INLINE_FUNCTION constexpr size_type dimension_0() const { return m_dim.N0; }
+            KOKKOS_INLINE_FUNCTION constexpr size_type dimension_1() const { return m_dim.N1; }
+            KOKKOS_INLINE_FUNCTION constexpr size_type dimension_2() const { return m_dim.N2; }
+            KOKKOS_INLINE_FUNCTION constexpr size_type dimension_3() const { return m_dim.N3; }
+            KOKKOS_INLINE_FUNCTION constexpr size_type dimension_4() const { return m_dim.N4; }
+            KOKKOS_INLINE_FUNCTION constexpr size_type dimension_5() const { return m_dim.N5; }
+            KOKKOS_INLINE_FUNCTION constexpr size_type dimension_6() const { return m_dim.N6; }
+            KOKKOS_INLINE_FUNCTION constexpr size_type dimension_7() const { return m_dim.N7; }
+
+            /* Cardinality of the domain index space */
+            KOKKOS_INLINE_FUNCTION
+            constexpr size_type size() const { return m_dim.N0 * m_dim.N1 * m_dim.N2 * m_dim.N3 * m_dim.N4 * m_dim.N5 * m_dim.N6 * m_dim.N7; }
+
+            /* Span of the range space - every run up to this view's last component in the last run, so a view of later components ends with the storage */
+            KOKKOS_INLINE_FUNCTION
+            constexpr size_type span() const { return runs() ? ( runs() - 1 ) * m_run + m_dim.N3 * Vector : 0; }
+
+            KOKKOS_INLINE_FUNCTION constexpr bool span_is_contiguous() const { return span() == size(); }
+
+            /* Strides are those within a run */
+            KOKKOS_INLINE_FUNCTION constexpr size_type stride_0() const { return m_dim.N1 * m_dim.N2; }
+            KOKKOS_INLINE_FUNCTION constexpr size_type stride_1() const { return m_dim.N2; }
+            KOKKOS_INLINE_FUNCTION constexpr size_type stride_2() const { return 1; }
+            KOKKOS_INLINE_FUNCTION constexpr size_type stride_3() const { return Vector; }
+            KOKKOS_INLINE_FUNCTION constexpr size_type stride_4() const { return span(); }
+            KOKKOS_INLINE_FUNCTION constexpr size_type stride_5() const { return span(); }
+            KOKKOS_INLINE_FUNCTION constexpr size_type stride_6() const { return span(); }
+            KOKKOS_INLINE_FUNCTION constexpr size_type stride_7() const { return span(); }
+
+            // Stride with [ rank ] value is the total length
+            template <typename iType>
+            KOKKOS_INLINE_FUNCTION void stride( iType *const s ) const {
+                s[0] = stride_0();
+                if ( 1 < dimension_type::rank ) s[1] = stride_1();
+                if ( 2 < dimension_type::rank ) s[2] = stride_2();
+                if ( 3 < dimension_type::rank ) s[3] = stride_3();
+                if ( 4 < dimension_type::rank ) s[4] = stride_4();
+                if ( 5 < dimension_type::rank ) s[5] = stride_5();
+                if ( 6 < dimension_type::rank ) s[6] = stride_6();
+                if ( 7 < dimension_type::rank ) s[7] = stride_7();
+                s[dimension_type::rank] = span();
+            }
+
+            //----------------------------------------
+
+            ViewOffset()                    = default;
+            ViewOffset( const ViewOffset & ) = default;
+            ViewOffset &operator=( const ViewOffset & ) = default;
+
+            template <unsigned TrivialScalarSize>
+            KOKKOS_INLINE_FUNCTION ViewOffset( std::integral_constant<unsigned, TrivialScalarSize> const &, array_layout const &arg_layout )
+                : m_dim( arg_layout.dimension[0], arg_layout.dimension[1], arg_layout.dimension[2], arg_layout.dimension[3], arg_layout.dimension[4], arg_layout.dimension[5], arg_layout.dimension[6], arg_layout.dimension[7] )
+                , m_run( Vector * ( arg_layout.components ? arg_layout.components : m_dim.N3 ) ) {
+                static_assert( int( dimension_type::rank ) <= 4, "LayoutCellAoSoA supports views of up to four indices" );
+            }
+
+            template <class DimRHS>
+            KOKKOS_INLINE_FUNCTION ViewOffset( const ViewOffset<DimRHS, array_layout, void> &rhs )
+                : m_dim( rhs.m_dim.N0, rhs.m_dim.N1, rhs.m_dim.N2, rhs.m_dim.N3, rhs.m_dim.N4, rhs.m_dim.N5, rhs.m_dim.N6, rhs.m_dim.N7 )
+                , m_run( rhs.m_run ) {
+                static_assert( int( DimRHS::rank ) == int( dimension_type::rank ), "ViewOffset assignment requires equal rank" );
+            }
+
+          private:
+            /**
+             * Runs Holding the Cells
+             **/
+            KOKKOS_INLINE_FUNCTION constexpr size_type runs() const { return ( m_dim.N0 * m_dim.N1 * m_dim.N2 + Vector - 1 ) / Vector; }
+
+            /**
+             * Offset of a Component of a Cell
+             **/
+            KOKKOS_INLINE_FUNCTION size_type run( const size_type cell, const size_type component ) const {
+                return ( cell / Vector ) * m_run + component * Vector + cell % Vector;
+            }
+        };
+
+    } // namespace Impl
+} // namespace Kokkos
+
+namespace ExaCLAMR {
+
+    /**
+ * Interleaved Cells are Numbered Row-Major, so their Offsets Rise Along the Rows
+ */
+    template <unsigned Vector>
+    struct LayoutRowMonotone<Kokkos::LayoutCellAoSoA<Vector>> : std::true_type {};
+
+    /**
+ * The CellStateAoSoA Class
+ * @class CellStateAoSoA
+ * @brief Height and momentum of every cell of one time level in a Cabana AoSoA
+ * Each SoA stores the heights of Vector consecutive cells, then their x-momenta, then their y-momenta
+ **/
+    template <class Scalar, unsigned Vector, class MemorySpace>
+    class CellStateAoSoA {
+      public:
+        typedef Cabana::MemberTypes<Scalar, Scalar[2]>                                                        member_types;
+        typedef Cabana::AoSoA<member_types, MemorySpace, Vector>                                              aosoa_type;
+        typedef Kokkos::View<Scalar ****, Kokkos::LayoutCellAoSoA<Vector>, MemorySpace, Kokkos::MemoryUnmanaged> view_type;
+
+        static const int components = 3; /**< Height, x-momentum and y-momentum */
+
+        static_assert( sizeof( typename aosoa_type::soa_type ) == components * Vector * sizeof( Scalar ), "Cell state SoA must hold exactly the interleaved components" );
+
+        /**
+         * Constructor
+         * @param label Label of the AoSoA
+         * @param n0 Cells along the first index, including ghost cells
+         * @param n1 Cells along the second index, including ghost cells
+         * @param n2 Cells along the third index, including ghost cells
+         */
+        CellStateAoSoA( const std::string &label, const long n0, const long n1, const long n2 )
+            : _aosoa( label, n0 * n1 * n2 )
+            , _extents{ n0, n1, n2 } {};
+
+        /**
+         * View of Consecutive Components of Every Cell
+         * @param first First component ( 0 - Height, 1 - X-Momentum, 2 - Y-Momentum )
+         * @param dofs Number of components in the view
+         * @return View indexed ( i, j, k, component )
+         **/
+        view_type view( const int first, const int dofs ) const {
+            Kokkos::LayoutCellAoSoA<Vector> layout( _extents[0], _extents[1], _extents[2], dofs );
+            layout.components = components;
+            return view_type( reinterpret_cast<Scalar *>( _aosoa.ptr() ) + first * Vector, layout );
+        };
+
+      private:
+        aosoa_type          _aosoa;   /**< Interleaved height and momentum */
+        std::array<long, 3> _extents; /**< Cells along each index */
+    };
+
+    /**
+ * The CellStateArray Class
+ * @class CellStateArray
+ * @brief Height or momentum of one time level in an interleaved cell state, with the interface of a Cajita array the problem manager and the packed halo use
+ **/
+    template <class Scalar, unsigned Vector, class MeshType, class MemorySpace>
+    class CellStateArray {
+      public:
+        typedef CellStateAoSoA<Scalar, Vector, MemorySpace>   state_type;
+        typedef typename state_type::view_type                 view_type;
+        typedef Cajita::ArrayLayout<Cajita::Cell, MeshType>    array_layout;
+        typedef MemorySpace                                    memory_space;
+
+        /**
+         * Constructor
+         * @param layout Cajita array layout of the field
+         * @param state Interleaved cell state holding the field
+         * @param first First component of the field in the cell state
+         */
+        CellStateArray( const std::shared_ptr<array_layout> &layout, const std::shared_ptr<state_type> &state, const int first )
+            : _layout( layout )
+            , _state( state )
+            , _view( state->view( first, layout->dofsPerEntity() ) ) {};
+
+        /**
+         * Return Array Layout
+         **/
+        const std::shared_ptr<array_layout> &layout() const {
+            return _layout;
+        };
+
+        /**
+         * Return View of the Field
+         **/
+        view_type view() const {
+            return _view;
+        };
+
+      private:
+        std::shared_ptr<array_layout> _layout; /**< Cajita array layout */
+        std::shared_ptr<state_type>   _state;  /**< Interleaved cell state the view points into */
+        view_type                     _view;   /**< View of the field */
+    };
+
+    /**
+ * @struct CellStorage
+ * @brief Creates the height and momentum arrays of a time level
+ * Every ordering but the interleaved one stores them in separate Cajita arrays
+ */
+    template <class Scalar, class OrderingView, class MeshType, class MemorySpace>
+    struct CellStorage {
+        typedef Cajita::Array<Scalar, Cajita::Cell, MeshType, OrderingView, MemorySpace> array_type;
+        typedef Cajita::ArrayLayout<Cajita::Cell, MeshType>                              layout_type;
+
+        /**
+         * Create the Height and Momentum Arrays of a Time Level
+         * @param vector_layout Layout of the momentum
+         * @param scalar_layout Layout of the height
+         * @param momentum Momentum array
+         * @param height Height array
+         **/
+        static void create( const std::shared_ptr<layout_type> &vector_layout, const std::shared_ptr<layout_type> &scalar_layout, std::shared_ptr<array_type> &momentum, std::shared_ptr<array_type> &height ) {
+            momentum = Cajita::createArray<Scalar, OrderingView, MemorySpace>( "momentum", vector_layout );
+            height   = Cajita::createArray<Scalar, OrderingView, MemorySpace>( "height", scalar_layout );
+        }
+
+        /**
+         * Create a Cajita Halo for Scattering the Arrays
+         **/
+        static std::shared_ptr<Cajita::Halo<MemorySpace>> halo( const Cajita::HaloPattern &pattern, const int width, const array_type &momentum, const array_type &height ) {
+            return Cajita::createHalo( pattern, width, momentum, height );
+        }
+
+        /**
+         * Scatter the Arrays with their Cajita Halo
+         **/
+        template <class ExecutionSpace>
+        static void scatter( const ExecutionSpace &exec_space, const std::shared_ptr<Cajita::Halo<MemorySpace>> &halo, const array_type &momentum, const array_type &height ) {
+            halo->scatter( exec_space, momentum, height );
+        }
+    };
+
+    template <class Scalar, unsigned Vector, class MeshType, class MemorySpace>
+    struct CellStorage<Scalar, Kokkos::LayoutCellAoSoA<Vector>, MeshType, MemorySpace> {
+        typedef CellStateArray<Scalar, Vector, MeshType, MemorySpace> array_type;
+        typedef Cajita::ArrayLayout<Cajita::Cell, MeshType>           layout_type;
+
+        /**
+         * Create the Height and Momentum Arrays of a Time Level Sharing One Interleaved Cell State
+         * @param vector_layout Layout of the momentum
+         * @param scalar_layout Layout of the height
+         * @param momentum Momentum array
+         * @param height Height array
+         **/
+        static void create( const std::shared_ptr<layout_type> &vector_layout, const std::shared_ptr<layout_type> &scalar_layout, std::shared_ptr<array_type> &momentum, std::shared_ptr<array_type> &height ) {
+            auto space = scalar_layout->indexSpace( Cajita::Ghost(), Cajita::Local() );
+            auto state = std::make_shared<typename array_type::state_type>( "cell_state", space.extent( 0 ), space.extent( 1 ), space.extent( 2 ) );
+
+            height   = std::make_shared<array_type>( scalar_layout, state, 0 );
+            momentum = std::make_shared<array_type>( vector_layout, state, 1 );
+        }
+
+        /**
+         * Cajita Halos Only Scatter Cajita Arrays - the Interleaved State is Gathered by the Packed Halo Alone
+         **/
+        static std::shared_ptr<Cajita::Halo<MemorySpace>> halo( const Cajita::HaloPattern &, const int, const array_type &, const array_type & ) {
+            return nullptr;
+        }
+
+        /**
+         * The Interleaved State has no Cajita Halo to Scatter With
+         **/
+        template <class ExecutionSpace>
+        static void scatter( const ExecutionSpace &, const std::shared_ptr<Cajita::Halo<MemorySpace>> &, const array_type &, const array_type & ) {
+            throw std::logic_error( "The interleaved cell state ( -o aosoa ) cannot be scattered" );
+        }
+    };
+
+} // namespace ExaCLAMR
+
+#endif
@@ -0,0 +1,285 @@
+/**
+ * @file
+ * @author Patrick Bridges <pbridges@unm.edu>
+ * @author Jered Dominguez-Trujillo <jereddt@unm.edu>
+ *
+ * @section DESCRIPTION
+ * Rank decomposition of the regular mesh
+ * Factors the rank count into the grid of blocks with the least halo surface for the cell counts of the mesh
+ * Optionally renumbers the ranks so that each node owns a compact tile of blocks and most neighbor pairs share a node
+ * or so that consecutive ranks own consecutive blocks along a Hilbert curve
+ */
+
+#ifndef EXACLAMR_DECOMPOSITION_HPP
+#define EXACLAMR_DECOMPOSITION_HPP
+
+#ifndef DEBUG
+#define DEBUG 0
+#endif
+
+// Include Statements
+#include <Input.hpp>
+#include <SpaceFillingCurve.hpp>
+
+#include <Cajita.hpp>
+
+#include <mpi.h>
+
+#include <array>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+namespace ExaCLAMR {
+
+    /**
+ * @struct DecompositionType
+ * @brief Struct which contains enums of the rank decomposition options
+ */
+    struct DecompositionType {
+        enum Values {
+            STRIPS  = 0,
+            SURFACE = 1,
+            NODE    = 2,
+            HILBERT = 3
+        };
+    };
+
+    /**
+ * @struct DecompositionStats
+ * @brief Communication surface of a rank decomposition
+ */
+    struct DecompositionStats {
+        long halo_cells;     /**< Cells exchanged across every rank boundary per halo layer */
+        long max_halo_cells; /**< Most cells any one rank exchanges per halo layer */
+        int  pairs;          /**< Neighboring rank pairs */
+        int  node_pairs;     /**< Neighboring rank pairs on the same node */
+    };
+
+    /**
+ * The Decomposition Class
+ * @class Decomposition
+ * @brief Chooses the number of ranks along each dimension and the communicator the grid is built on
+ * Blocks are numbered in the row-major order of Cajita's Cartesian communicator, so the rank of the block at ( i, j ) is i * y_ranks + j
+ **/
+    class Decomposition {
+      public:
+        /**
+         * Constructor
+         * Factors the ranks of the communicator and renumbers them when node-aware mapping is requested
+         *
+         * @param cl Command line arguments
+         * @param comm MPI communicator to decompose
+         */
+        template <typename state_t>
+        Decomposition( const ClArgs<state_t> &cl, MPI_Comm comm )
+            : _global_num_cells( cl.global_num_cells )
+            , _periodic( cl.periodic )
+            , _comm( comm )
+            , _node_mapped( false )
+            , _curve_mapped( false ) {
+            int comm_size, rank;
+            MPI_Comm_size( comm, &comm_size );
+            MPI_Comm_rank( comm, &rank );
+
+            int type = DecompositionType::SURFACE;
+            if ( !cl.decomposition.compare( "strips" ) )
+                type = DecompositionType::STRIPS;
+            else if ( !cl.decomposition.compare( "node" ) )
+                type = DecompositionType::NODE;
+            else if ( !cl.decomposition.compare( "hilbert" ) )
+                type = DecompositionType::HILBERT;
+
+            if ( type == DecompositionType::STRIPS ) {
+                // Halve the Rank Count Until it is Odd or Two
+                int x_ranks = comm_size;
+                while ( x_ranks % 2 == 0 && x_ranks > 2 ) {
+                    x_ranks /= 2;
+                }
+                _ranks_per_dim = { x_ranks, comm_size / x_ranks, 1 };
+            } else {
+                // Every Factor Pair of the Rank Count - Keep the Least Halo Surface
+                long best = std::numeric_limits<long>::max();
+                for ( int x_ranks = 1; x_ranks <= comm_size; x_ranks++ ) {
+                    if ( comm_size % x_ranks ) continue;
+                    long surface = haloSurface( x_ranks, comm_size / x_ranks );
+                    if ( surface < best ) best = surface, _ranks_per_dim = { x_ranks, comm_size / x_ranks, 1 };
+                }
+            }
+
+            // Node of Every Rank
+            MPI_Comm node_comm, leader_comm;
+            int      node_rank, node_size, node_id, num_nodes;
+            MPI_Comm_split_type( comm, MPI_COMM_TYPE_SHARED, rank, MPI_INFO_NULL, &node_comm );
+            MPI_Comm_rank( node_comm, &node_rank );
+            MPI_Comm_size( node_comm, &node_size );
+
+            MPI_Comm_split( comm, node_rank == 0 ? 0 : MPI_UNDEFINED, rank, &leader_comm );
+            if ( node_rank == 0 ) {
+                MPI_Comm_rank( leader_comm, &node_id );
+                MPI_Comm_size( leader_comm, &num_nodes );
+                MPI_Comm_free( &leader_comm );
+            }
+            MPI_Bcast( &node_id, 1, MPI_INT, 0, node_comm );
+            MPI_Bcast( &num_nodes, 1, MPI_INT, 0, node_comm );
+            MPI_Comm_free( &node_comm );
+
+            if ( type == DecompositionType::NODE ) mapNodes( comm, node_rank, node_size, node_id, num_nodes );
+            if ( type == DecompositionType::HILBERT ) mapCurve( comm, rank );
+
+            // Node of Every Rank of the Decomposed Communicator
+            _node_ids.resize( comm_size );
+            MPI_Allgather( &node_id, 1, MPI_INT, _node_ids.data(), 1, MPI_INT, _comm );
+
+            if ( DEBUG ) std::cout << "X Ranks: " << _ranks_per_dim[0] << " Y Ranks: " << _ranks_per_dim[1] << "\n";
+        };
+
+        ~Decomposition() {
+            if ( _node_mapped || _curve_mapped ) MPI_Comm_free( &_comm );
+        };
+
+        Decomposition( const Decomposition & ) = delete;
+        Decomposition &operator=( const Decomposition & ) = delete;
+
+        /**
+         * Get the Communicator to Build the Grid On - Must Outlive the Solver
+         **/
+        MPI_Comm comm() const { return _comm; };
+
+        /**
+         * Get the Number of Ranks Along Each Dimension
+         **/
+        const std::array<int, 3> &ranksPerDim() const { return _ranks_per_dim; };
+
+        /**
+         * Create the Cajita Partitioner of the Decomposition
+         **/
+        Cajita::ManualPartitioner partitioner() const { return Cajita::ManualPartitioner( _ranks_per_dim ); };
+
+        /**
+         * Whether the Ranks were Renumbered to Keep Neighbors on the Same Node
+         **/
+        bool nodeMapped() const { return _node_mapped; };
+
+        /**
+         * Whether the Ranks were Renumbered to Follow a Hilbert Curve Through the Blocks
+         **/
+        bool curveMapped() const { return _curve_mapped; };
+
+        /**
+         * Get the Node of Each Rank of the Decomposed Communicator
+         **/
+        const std::vector<int> &nodeIds() const { return _node_ids; };
+
+        /**
+         * Measure the Communication Surface of the Decomposition
+         * Collective over the decomposed communicator
+         **/
+        DecompositionStats stats() const {
+            int rank;
+            MPI_Comm_rank( _comm, &rank );
+
+            std::array<int, 2> coords = { rank / _ranks_per_dim[1], rank % _ranks_per_dim[1] };
+            std::array<int, 2> extent = { blockExtent( 0, coords[0] ), blockExtent( 1, coords[1] ) };
+
+            // Face Neighbors of this Rank
+            long halo_cells = 0;
+            int  pairs = 0, node_pairs = 0;
+            for ( int d = 0; d < 2; d++ ) {
+                for ( int side = -1; side < 2; side += 2 ) {
+                    std::array<int, 2> neighbor = coords;
+                    neighbor[d] += side;
+                    if ( neighbor[d] < 0 || neighbor[d] >= _ranks_per_dim[d] ) {
+                        if ( !_periodic[d] || _ranks_per_dim[d] == 1 ) continue;
+                        neighbor[d] = ( neighbor[d] + _ranks_per_dim[d] ) % _ranks_per_dim[d];
+                    }
+
+                    int neighbor_rank = neighbor[0] * _ranks_per_dim[1] + neighbor[1];
+                    halo_cells += extent[1 - d] * (long)_global_num_cells[2];
+                    pairs++;
+                    if ( _node_ids[neighbor_rank] == _node_ids[rank] ) node_pairs++;
+                }
+            }
+
+            DecompositionStats stats;
+            MPI_Allreduce( &halo_cells, &stats.halo_cells, 1, MPI_LONG, MPI_SUM, _comm );
+            MPI_Allreduce( &halo_cells, &stats.max_halo_cells, 1, MPI_LONG, MPI_MAX, _comm );
+            MPI_Allreduce( &pairs, &stats.pairs, 1, MPI_INT, MPI_SUM, _comm );
+            MPI_Allreduce( &node_pairs, &stats.node_pairs, 1, MPI_INT, MPI_SUM, _comm );
+
+            // Each Pair was Counted from Both Sides
+            stats.halo_cells /= 2;
+            stats.pairs /= 2;
+            stats.node_pairs /= 2;
+
+            return stats;
+        };
+
+      private:
+        /**
+         * Cells Shared Across Every Rank Boundary of an x_ranks by y_ranks Grid of Blocks per Halo Layer
+         **/
+        long haloSurface( const int x_ranks, const int y_ranks ) const {
+            return ( (long)( x_ranks - 1 ) * _global_num_cells[1] + (long)( y_ranks - 1 ) * _global_num_cells[0] ) * _global_num_cells[2];
+        };
+
+        /**
+         * Number of Cells of a Block Along a Dimension - Cajita Gives the Remainder to the Lowest Blocks
+         **/
+        int blockExtent( const int dim, const int coord ) const {
+            return _global_num_cells[dim] / _ranks_per_dim[dim] + ( coord < _global_num_cells[dim] % _ranks_per_dim[dim] );
+        };
+
+        /**
+         * Renumber the Ranks so that Each Node Owns a Compact Tile of Blocks
+         * Chooses the tile shape with the least halo surface between nodes
+         * Nodes must hold equal rank counts whose tiles divide the grid of blocks, otherwise the ranks keep their order
+         **/
+        void mapNodes( MPI_Comm comm, const int node_rank, const int node_size, const int node_id, const int num_nodes ) {
+            int min_node_size, max_node_size;
+            MPI_Allreduce( &node_size, &min_node_size, 1, MPI_INT, MPI_MIN, comm );
+            MPI_Allreduce( &node_size, &max_node_size, 1, MPI_INT, MPI_MAX, comm );
+            if ( min_node_size != max_node_size || num_nodes == 1 ) return;
+
+            std::array<int, 2> tile = { 0, 0 };
+            long               best = std::numeric_limits<long>::max();
+            for ( int tx = 1; tx <= node_size; tx++ ) {
+                int ty = node_size / tx;
+                if ( node_size % tx || _ranks_per_dim[0] % tx || _ranks_per_dim[1] % ty ) continue;
+                long surface = haloSurface( _ranks_per_dim[0] / tx, _ranks_per_dim[1] / ty );
+                if ( surface < best ) best = surface, tile = { tx, ty };
+            }
+            if ( !tile[0] ) return;
+
+            // Block of this Rank - Nodes Tile the Grid of Blocks Row-Major, Ranks Tile their Node Row-Major
+            int nodes_y = _ranks_per_dim[1] / tile[1];
+            int x       = ( node_id / nodes_y ) * tile[0] + node_rank / tile[1];
+            int y       = ( node_id % nodes_y ) * tile[1] + node_rank % tile[1];
+
+            MPI_Comm_split( comm, 0, x * _ranks_per_dim[1] + y, &_comm );
+            _node_mapped = true;
+        };
+
+        /**
+         * Renumber the Ranks so that Consecutive Ranks Own Consecutive Blocks Along a Hilbert Curve
+         * Ranks sharing a node are usually numbered consecutively, so each node owns a compact run of blocks whatever its rank count
+         **/
+        void mapCurve( MPI_Comm comm, const int rank ) {
+            auto blocks = SpaceFillingCurve::hilbertCells( _ranks_per_dim[0], _ranks_per_dim[1] );
+
+            MPI_Comm_split( comm, 0, blocks[rank][0] * _ranks_per_dim[1] + blocks[rank][1], &_comm );
+            _curve_mapped = true;
+        };
+
+        std::array<int, 3>  _global_num_cells; /**< Global number of cells */
+        std::array<bool, 3> _periodic;         /**< Periodicity of domain */
+        std::array<int, 3>  _ranks_per_dim;    /**< Number of ranks along each dimension */
+        std::vector<int>    _node_ids;         /**< Node of each rank of the decomposed communicator */
+        MPI_Comm            _comm;             /**< Decomposed communicator */
+        bool                _node_mapped;      /**< Ranks were renumbered by node */
+        bool                _curve_mapped;     /**< Ranks were renumbered along a Hilbert curve */
+    };
+
+} // namespace ExaCLAMR
+
+#endif
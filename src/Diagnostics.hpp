@@ -0,0 +1,279 @@
+/**
+ * @file
+ * @author Patrick Bridges <pbridges@unm.edu>
+ * @author Jered Dominguez-Trujillo <jereddt@unm.edu>
+ *
+ * @section DESCRIPTION
+ * Diagnostics of the system state: time step, mass, momentum, maximum height and maximum speed
+ * Packs every diagnostic into a single value so they can be reduced together inside the finite volume kernels
+ * Reduces the packed value across ranks with a single MPI_Allreduce
+ */
+
+#ifndef EXACLAMR_DIAGNOSTICS_HPP
+#define EXACLAMR_DIAGNOSTICS_HPP
+
+#ifndef DEBUG
+#define DEBUG 0
+#endif
+
+// Include Statements
+#include <Input.hpp>
+
+#include <Cajita.hpp>
+#include <Kokkos_Core.hpp>
+
+#include <mpi.h>
+
+#include <array>
+#include <iomanip>
+#include <iostream>
+#include <math.h>
+
+namespace ExaCLAMR {
+
+    /**
+ * @struct DiagnosticType
+ * @brief Struct which contains enums of the diagnostics, in the order they are given on the command line
+ */
+    struct DiagnosticType {
+        enum Values {
+            MASS       = 0,
+            MOMENTUM   = 1,
+            MAX_HEIGHT = 2,
+            MAX_SPEED  = 3,
+            DT         = 4,
+            COUNT      = 5
+        };
+
+        /**
+         * Bit of a diagnostic in a diagnostics mask
+         * @param type Diagnostic type
+         **/
+        KOKKOS_INLINE_FUNCTION
+        static constexpr int bit( const int type ) { return 1 << type; }
+    };
+
+    /**
+ * @struct DiagnosticValues
+ * @brief Packed diagnostic values - reduced as a single value on device and across ranks
+ */
+    template <typename state_t>
+    struct DiagnosticValues {
+        state_t dt;          /**< Minimum time step */
+        state_t mass;        /**< Total mass */
+        state_t momentum[2]; /**< Total x and y momentum */
+        state_t max_height;  /**< Maximum height */
+        state_t max_speed;   /**< Maximum fluid speed */
+    };
+
+    /**
+ * Set Diagnostic Values to the Identity of their Reductions
+ * @param val Diagnostic values
+ */
+    template <typename state_t>
+    KOKKOS_INLINE_FUNCTION void diagnosticsInit( DiagnosticValues<state_t> &val ) {
+        val.dt          = Kokkos::reduction_identity<state_t>::min();
+        val.mass        = Kokkos::reduction_identity<state_t>::sum();
+        val.momentum[0] = Kokkos::reduction_identity<state_t>::sum();
+        val.momentum[1] = Kokkos::reduction_identity<state_t>::sum();
+        val.max_height  = Kokkos::reduction_identity<state_t>::max();
+        val.max_speed   = Kokkos::reduction_identity<state_t>::max();
+    }
+
+    /**
+ * Join Diagnostic Values: Minimum Time Step, Summed Mass and Momentum, Maximum Height and Speed
+ * @param dest Destination diagnostic values
+ * @param src Source diagnostic values
+ */
+    template <class DestType, class SrcType>
+    KOKKOS_INLINE_FUNCTION void diagnosticsJoin( DestType &dest, const SrcType &src ) {
+        if ( src.dt < dest.dt ) dest.dt = src.dt;
+        dest.mass += src.mass;
+        dest.momentum[0] += src.momentum[0];
+        dest.momentum[1] += src.momentum[1];
+        if ( src.max_height > dest.max_height ) dest.max_height = src.max_height;
+        if ( src.max_speed > dest.max_speed ) dest.max_speed = src.max_speed;
+    }
+
+    /**
+ * Accumulate the Diagnostics of a Single Cell
+ *
+ * @param val Diagnostic values
+ * @param diagnostics Mask of diagnostics to accumulate
+ * @param dt Wave speed limited time step of the cell
+ * @param h Height
+ * @param u X-Momentum ( u )
+ * @param v Y-Momentum ( v )
+ */
+    template <typename state_t>
+    KOKKOS_INLINE_FUNCTION void diagnosticsAccumulate( DiagnosticValues<state_t> &val, const int diagnostics, state_t dt, state_t h, state_t u, state_t v ) {
+        if ( diagnostics & DiagnosticType::bit( DiagnosticType::DT ) ) {
+            if ( dt < val.dt ) val.dt = dt;
+        }
+        if ( diagnostics & DiagnosticType::bit( DiagnosticType::MASS ) ) val.mass += h;
+        if ( diagnostics & DiagnosticType::bit( DiagnosticType::MOMENTUM ) ) {
+            val.momentum[0] += u;
+            val.momentum[1] += v;
+        }
+        if ( diagnostics & DiagnosticType::bit( DiagnosticType::MAX_HEIGHT ) ) {
+            if ( h > val.max_height ) val.max_height = h;
+        }
+        if ( diagnostics & DiagnosticType::bit( DiagnosticType::MAX_SPEED ) ) {
+            state_t speed = sqrt( u * u + v * v ) / h;
+            if ( speed > val.max_speed ) val.max_speed = speed;
+        }
+    }
+
+    /**
+ * @struct DiagnosticsReducer
+ * @brief Kokkos reducer for the packed diagnostic values
+ */
+    template <typename state_t, class Space>
+    struct DiagnosticsReducer {
+      public:
+        typedef DiagnosticsReducer              reducer;
+        typedef DiagnosticValues<state_t>       value_type;
+        typedef Kokkos::View<value_type, Space> result_view_type;
+
+      private:
+        result_view_type _value;
+        bool             _references_scalar;
+
+      public:
+        KOKKOS_INLINE_FUNCTION
+        DiagnosticsReducer( value_type &value )
+            : _value( &value )
+            , _references_scalar( true ) {}
+
+        KOKKOS_INLINE_FUNCTION
+        DiagnosticsReducer( const result_view_type &value )
+            : _value( value )
+            , _references_scalar( false ) {}
+
+        KOKKOS_INLINE_FUNCTION
+        void join( value_type &dest, const value_type &src ) const { diagnosticsJoin( dest, src ); }
+
+        KOKKOS_INLINE_FUNCTION
+        void join( volatile value_type &dest, const volatile value_type &src ) const { diagnosticsJoin( dest, src ); }
+
+        KOKKOS_INLINE_FUNCTION
+        void init( value_type &val ) const { diagnosticsInit( val ); }
+
+        KOKKOS_INLINE_FUNCTION
+        value_type &reference() const { return *_value.data(); }
+
+        KOKKOS_INLINE_FUNCTION
+        result_view_type view() const { return _value; }
+
+        KOKKOS_INLINE_FUNCTION
+        bool references_scalar() const { return _references_scalar; }
+    };
+
+    /**
+ * The Diagnostics Class
+ * @class Diagnostics
+ * @brief Diagnostics class to track when each diagnostic is due, reduce them across ranks and print them
+ **/
+    template <typename state_t>
+    class Diagnostics {
+      public:
+        /**
+         * Constructor
+         * Store the cadence of each diagnostic and create the MPI datatype and operation of the packed values
+         *
+         * @param cl Command line arguments
+         * @param comm MPI communicator
+         */
+        Diagnostics( const ExaCLAMR::ClArgs<state_t> &cl, MPI_Comm comm )
+            : _freq( cl.diagnostic_freq )
+            , _comm( comm ) {
+            MPI_Type_contiguous( sizeof( DiagnosticValues<state_t> ) / sizeof( state_t ), Cajita::MpiTraits<state_t>::type(), &_type );
+            MPI_Type_commit( &_type );
+            MPI_Op_create( &Diagnostics::mpiJoin, 1, &_op );
+        }
+
+        /**
+         * Destructor
+         * Free the MPI datatype and operation
+         **/
+        ~Diagnostics() {
+            int finalized;
+            MPI_Finalized( &finalized );
+            if ( !finalized ) {
+                MPI_Op_free( &_op );
+                MPI_Type_free( &_type );
+            }
+        }
+
+        Diagnostics( const Diagnostics & ) = delete;
+        Diagnostics &operator=( const Diagnostics & ) = delete;
+
+        /**
+         * Mask of the diagnostics that are due on a time step
+         * @param time_step Current time step
+         * @return Diagnostics mask
+         **/
+        int due( const int time_step ) const {
+            int diagnostics = 0;
+            for ( int d = 0; d < DiagnosticType::COUNT; d++ ) {
+                if ( _freq[d] > 0 && 0 == time_step % _freq[d] ) diagnostics |= DiagnosticType::bit( d );
+            }
+            return diagnostics;
+        }
+
+        /**
+         * Mask of every diagnostic
+         * @return Diagnostics mask
+         **/
+        static constexpr int all() { return DiagnosticType::bit( DiagnosticType::COUNT ) - 1; }
+
+        /**
+         * Reduce Packed Diagnostic Values Across All Ranks with a Single MPI_Allreduce
+         * @param local Diagnostic values of this rank
+         * @return Diagnostic values of the whole domain
+         **/
+        DiagnosticValues<state_t> allreduce( const DiagnosticValues<state_t> &local ) const {
+            DiagnosticValues<state_t> global;
+            MPI_Allreduce( &local, &global, 1, _type, _op, _comm );
+            return global;
+        }
+
+        /**
+         * Print Diagnostic Values that are in a Mask
+         * @param diagnostics Mask of diagnostics to print
+         * @param values Diagnostic values of the whole domain
+         * @param initial Diagnostic values of the initial state
+         **/
+        void print( const int diagnostics, const DiagnosticValues<state_t> &values, const DiagnosticValues<state_t> &initial ) const {
+            if ( diagnostics & DiagnosticType::bit( DiagnosticType::MASS ) )
+                std::cout << std::left << std::setw( 15 ) << "Mass Change: " << std::left << std::setw( 14 ) << initial.mass - values.mass;
+            if ( diagnostics & DiagnosticType::bit( DiagnosticType::MOMENTUM ) )
+                std::cout << std::left << std::setw( 15 ) << "Momentum: " << std::left << std::setw( 14 ) << values.momentum[0] << std::left << std::setw( 14 ) << values.momentum[1];
+            if ( diagnostics & DiagnosticType::bit( DiagnosticType::MAX_HEIGHT ) )
+                std::cout << std::left << std::setw( 15 ) << "Max Height: " << std::left << std::setw( 14 ) << values.max_height;
+            if ( diagnostics & DiagnosticType::bit( DiagnosticType::MAX_SPEED ) )
+                std::cout << std::left << std::setw( 15 ) << "Max Speed: " << std::left << std::setw( 14 ) << values.max_speed;
+            if ( diagnostics & DiagnosticType::bit( DiagnosticType::DT ) )
+                std::cout << std::left << std::setw( 15 ) << "Time Step: " << std::left << std::setw( 14 ) << values.dt;
+        }
+
+      private:
+        /**
+         * MPI User Operation Joining Packed Diagnostic Values
+         **/
+        static void mpiJoin( void *in, void *inout, int *len, MPI_Datatype * ) {
+            DiagnosticValues<state_t> *src  = static_cast<DiagnosticValues<state_t> *>( in );
+            DiagnosticValues<state_t> *dest = static_cast<DiagnosticValues<state_t> *>( inout );
+            for ( int n = 0; n < *len; n++ ) diagnosticsJoin( dest[n], src[n] );
+        }
+
+        std::array<int, DiagnosticType::COUNT> _freq; /**< Cadence of each diagnostic in time steps ( 0 disables ) */
+
+        MPI_Comm     _comm; /**< MPI communicator */
+        MPI_Datatype _type; /**< MPI datatype of the packed values */
+        MPI_Op       _op;   /**< MPI operation joining the packed values */
+    };
+
+} // namespace ExaCLAMR
+
+#endif
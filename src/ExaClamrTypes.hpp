@@ -5,10 +5,14 @@
 
 namespace ExaCLAMR {
 
-    template <class Scalar>
+    // Uniform mesh tag.
+    template <class Scalar, class Storage = Scalar>
     struct RegularMesh {
         // Scalar type for mesh floating point operations.
         using scalar_type = Scalar;
+
+        // Scalar type the state is stored in.
+        using storage_type = Storage;
     };
 
     // Non-uniform mesh tag.
@@ -23,12 +27,12 @@ namespace ExaCLAMR {
     struct isExaMeshType : public std::false_type {
     };
 
-    template <class Scalar>
-    struct isExaMeshType<RegularMesh<Scalar>> : public std::true_type {
+    template <class Scalar, class Storage>
+    struct isExaMeshType<RegularMesh<Scalar, Storage>> : public std::true_type {
     };
 
-    template <class Scalar>
-    struct isExaMeshType<const RegularMesh<Scalar>> : public std::true_type {
+    template <class Scalar, class Storage>
+    struct isExaMeshType<const RegularMesh<Scalar, Storage>> : public std::true_type {
     };
 
     template <class Scalar>
@@ -44,12 +48,12 @@ namespace ExaCLAMR {
     struct isRegularMesh : public std::false_type {
     };
 
-    template <class Scalar>
-    struct isRegularMesh<RegularMesh<Scalar>> : public std::true_type {
+    template <class Scalar, class Storage>
+    struct isRegularMesh<RegularMesh<Scalar, Storage>> : public std::true_type {
     };
 
-    template <class Scalar>
-    struct isRegularMesh<const RegularMesh<Scalar>> : public std::true_type {
+    template <class Scalar, class Storage>
+    struct isRegularMesh<const RegularMesh<Scalar, Storage>> : public std::true_type {
     };
 
     // Non-uniform mesh checker.
@@ -0,0 +1,205 @@
+/**
+ * @file
+ * @author Patrick Bridges <pbridges@unm.edu>
+ * @author Jered Dominguez-Trujillo <jereddt@unm.edu>
+ *
+ * @section DESCRIPTION
+ * Packed halo exchange of the cell state arrays of one time level
+ * Every array is packed into a single preallocated buffer per neighbor, so each gather sends one message per neighbor
+ * Each array has its own halo depth
+ * The buffers are moved by a halo transport
+ * The gather can be split into a non-blocking start and a finish to overlap it with computation
+ */
+
+#ifndef EXACLAMR_HALO_HPP
+#define EXACLAMR_HALO_HPP
+
+#ifndef DEBUG
+#define DEBUG 0
+#endif
+
+// Include Statements
+#include <Cajita.hpp>
+#include <HaloTransport.hpp>
+#include <Kokkos_Core.hpp>
+
+#include <mpi.h>
+
+#include <array>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+namespace ExaCLAMR {
+
+    /**
+ * The PackedHalo Class
+ * @class PackedHalo
+ * @brief Gathers the ghost cells of a set of cell arrays from the neighbors of a halo pattern with one message per neighbor
+ * gatherStart packs the owned cells of every array shared with each neighbor into its send buffer and starts the transport
+ * gatherFinish unpacks each receive buffer into the ghost cells as soon as the transport delivers it
+ * Computation that reads no ghost cells can run between the two
+ **/
+    template <class Scalar, class MemorySpace>
+    class PackedHalo {
+      public:
+        typedef Kokkos::View<Scalar *, MemorySpace> buffer_view;
+        typedef HaloTransport<Scalar, MemorySpace>  transport_type;
+
+        /**
+         * Constructor
+         * Finds the rank of every neighbor in the halo pattern and the cells each array shares with it
+         * Creates the transport, which allocates the send and receive buffer of every neighbor once, sized for every array
+         *
+         * @param pattern Cajita halo pattern
+         * @param widths Number of ghost cells exchanged for each array
+         * @param transport Halo transport type ( HaloTransportType )
+         * @param arrays Cell arrays of one time level in the order they are gathered - arrays of other time levels must share their layouts
+         */
+        template <class ArrayType, class... ArrayTypes>
+        PackedHalo( const Cajita::HaloPattern &pattern, const std::vector<int> &widths, const int transport, const ArrayType &array, const ArrayTypes &... arrays )
+            : _widths( widths ) {
+            auto             local_grid = array.layout()->localGrid();
+            std::vector<int> dofs       = { array.layout()->dofsPerEntity(), arrays.layout()->dofsPerEntity()... };
+
+            if ( dofs.size() != _widths.size() ) throw std::runtime_error( "Packed halo needs one width per array" );
+
+            std::vector<int>                neighbors;
+            std::vector<std::array<int, 3>> offsets;
+            std::vector<long>               send_sizes, recv_sizes;
+
+            for ( auto &n : pattern.getNeighbors() ) {
+                int rank = local_grid->neighborRank( n );
+                if ( rank < 0 ) continue;
+
+                neighbors.push_back( rank );
+                offsets.push_back( n );
+
+                // Shared Cells and Buffer Offsets of Each Array
+                std::vector<Cajita::IndexSpace<3>> owned_spaces, ghost_spaces;
+                std::vector<long>                  send_offsets, recv_offsets;
+                long                               send_size = 0, recv_size = 0;
+                for ( int a = 0; a < (int)dofs.size(); a++ ) {
+                    owned_spaces.push_back( local_grid->sharedIndexSpace( Cajita::Own(), Cajita::Cell(), n, _widths[a] ) );
+                    ghost_spaces.push_back( local_grid->sharedIndexSpace( Cajita::Ghost(), Cajita::Cell(), n, _widths[a] ) );
+
+                    send_offsets.push_back( send_size );
+                    recv_offsets.push_back( recv_size );
+                    send_size += owned_spaces[a].size() * dofs[a];
+                    recv_size += ghost_spaces[a].size() * dofs[a];
+                }
+
+                _owned_spaces.push_back( owned_spaces );
+                _ghost_spaces.push_back( ghost_spaces );
+                _send_offsets.push_back( send_offsets );
+                _recv_offsets.push_back( recv_offsets );
+
+                send_sizes.push_back( send_size );
+                recv_sizes.push_back( recv_size );
+            }
+
+            _num_nbrs  = neighbors.size();
+            _transport = createHaloTransport<Scalar, MemorySpace>( transport, local_grid->globalGrid().comm(), neighbors, offsets, send_sizes, recv_sizes );
+        }
+
+        /**
+         * Gather and Wait for the Ghost Cells
+         *
+         * @param exec_space Execution space
+         * @param arrays Cell arrays to gather, in the order given to the constructor
+         **/
+        template <class ExecutionSpace, class... ArrayTypes>
+        void gather( const ExecutionSpace &exec_space, const ArrayTypes &... arrays ) {
+            gatherStart( exec_space, arrays... );
+            gatherFinish( exec_space, arrays... );
+        }
+
+        /**
+         * Start a Gather
+         * Opens the transport, packs the owned cells shared with each neighbor and starts moving the send buffers
+         * The ghost cells of the arrays must not be read until the gather is finished
+         *
+         * @param exec_space Execution space
+         * @param arrays Cell arrays to gather, in the order given to the constructor
+         **/
+        template <class ExecutionSpace, class ArrayType, class... ArrayTypes>
+        void gatherStart( const ExecutionSpace &exec_space, const ArrayType &array, const ArrayTypes &... arrays ) {
+            std::vector<typename ArrayType::view_type> views = { array.view(), arrays.view()... };
+
+            // Open First so Messages can Land Directly in the Receive Buffers
+            _transport->open();
+
+            // Pack Every Array Shared with Each Neighbor into its Send Buffer
+            for ( int n = 0; n < _num_nbrs; n++ ) {
+                for ( int a = 0; a < (int)views.size(); a++ ) pack( exec_space, views[a], _owned_spaces[n][a], _transport->sendBuffer( n ), _send_offsets[n][a] );
+            }
+            exec_space.fence();
+
+            _transport->start();
+        }
+
+        /**
+         * Finish a Gather
+         * Unpacks each neighbor's receive buffer into the ghost cells as it arrives, then closes the transport
+         *
+         * @param exec_space Execution space
+         * @param arrays Cell arrays to gather, in the order given to the constructor
+         **/
+        template <class ExecutionSpace, class ArrayType, class... ArrayTypes>
+        void gatherFinish( const ExecutionSpace &exec_space, const ArrayType &array, const ArrayTypes &... arrays ) {
+            std::vector<typename ArrayType::view_type> views = { array.view(), arrays.view()... };
+
+            // Unpack Receive Buffers in the Order they Arrive
+            _transport->finish( [&]( const int n ) {
+                for ( int a = 0; a < (int)views.size(); a++ ) unpack( exec_space, _transport->recvBuffer( n ), _recv_offsets[n][a], _ghost_spaces[n][a], views[a] );
+            } );
+            exec_space.fence();
+
+            _transport->close();
+        }
+
+      private:
+        /**
+         * Pack an Index Space of a View into a Buffer Starting at an Offset
+         **/
+        template <class ExecutionSpace, class ViewType>
+        static void pack( const ExecutionSpace &exec_space, const ViewType &view, const Cajita::IndexSpace<3> &space, const buffer_view &buffer, const long start ) {
+            long imin = space.min( 0 ), jmin = space.min( 1 ), kmin = space.min( 2 );
+            long nj = space.extent( 1 ), nk = space.extent( 2 ), dofs = view.extent( 3 );
+
+            Kokkos::parallel_for(
+                "Halo_Pack", Cajita::createExecutionPolicy( space, exec_space ), KOKKOS_LAMBDA( const int i, const int j, const int k ) {
+                    long offset = start + ( ( ( i - imin ) * nj + ( j - jmin ) ) * nk + ( k - kmin ) ) * dofs;
+                    for ( int d = 0; d < dofs; d++ ) buffer( offset + d ) = view( i, j, k, d );
+                } );
+        }
+
+        /**
+         * Unpack a Buffer Starting at an Offset into an Index Space of a View
+         **/
+        template <class ExecutionSpace, class ViewType>
+        static void unpack( const ExecutionSpace &exec_space, const buffer_view &buffer, const long start, const Cajita::IndexSpace<3> &space, const ViewType &view ) {
+            long imin = space.min( 0 ), jmin = space.min( 1 ), kmin = space.min( 2 );
+            long nj = space.extent( 1 ), nk = space.extent( 2 ), dofs = view.extent( 3 );
+
+            Kokkos::parallel_for(
+                "Halo_Unpack", Cajita::createExecutionPolicy( space, exec_space ), KOKKOS_LAMBDA( const int i, const int j, const int k ) {
+                    long offset = start + ( ( ( i - imin ) * nj + ( j - jmin ) ) * nk + ( k - kmin ) ) * dofs;
+                    for ( int d = 0; d < dofs; d++ ) view( i, j, k, d ) = buffer( offset + d );
+                } );
+        }
+
+        std::vector<int> _widths;   /**< Halo depth of each array */
+        int              _num_nbrs; /**< Number of neighbors */
+
+        std::vector<std::vector<Cajita::IndexSpace<3>>> _owned_spaces; /**< Owned cells of each array sent to each neighbor */
+        std::vector<std::vector<Cajita::IndexSpace<3>>> _ghost_spaces; /**< Ghost cells of each array received from each neighbor */
+        std::vector<std::vector<long>>                  _send_offsets; /**< Offset of each array in each send buffer */
+        std::vector<std::vector<long>>                  _recv_offsets; /**< Offset of each array in each receive buffer */
+
+        std::shared_ptr<transport_type> _transport; /**< Moves the buffers between neighbors */
+    };
+
+} // namespace ExaCLAMR
+
+#endif
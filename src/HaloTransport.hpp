@@ -0,0 +1,511 @@
+/**
+ * @file
+ * @author Patrick Bridges <pbridges@unm.edu>
+ * @author Jered Dominguez-Trujillo <jereddt@unm.edu>
+ *
+ * @section DESCRIPTION
+ * Transports moving the packed halo buffers between neighbors
+ * Nonblocking and persistent point-to-point messages, a neighborhood collective, one-sided RMA and intra-node shared memory
+ */
+
+#ifndef EXACLAMR_HALOTRANSPORT_HPP
+#define EXACLAMR_HALOTRANSPORT_HPP
+
+#ifndef DEBUG
+#define DEBUG 0
+#endif
+
+// Include Statements
+#include <Kokkos_Core.hpp>
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace ExaCLAMR {
+
+    /**
+ * @struct HaloTransportType
+ * @brief Struct which contains enums of the halo transport options
+ */
+    struct HaloTransportType {
+        enum Values {
+            NONBLOCKING = 0,
+            PERSISTENT  = 1,
+            NEIGHBOR    = 2,
+            RMA         = 3,
+            SHARED      = 4
+        };
+    };
+
+    /**
+ * The HaloTransport Class
+ * @class HaloTransport
+ * @brief Owns the send and receive buffer of every neighbor and moves the send buffers into the neighbors' receive buffers
+ * A gather calls open before packing the send buffers, start once they are packed, finish to wait for the receive buffers and close once they are unpacked
+ **/
+    template <class Scalar, class MemorySpace>
+    class HaloTransport {
+      public:
+        typedef Kokkos::View<Scalar *, MemorySpace> buffer_view;
+
+        /**
+         * Constructor
+         *
+         * @param comm MPI communicator of the grid
+         * @param neighbors Rank of each neighbor
+         * @param offsets Direction of each neighbor
+         * @param send_sizes Number of values sent to each neighbor
+         * @param recv_sizes Number of values received from each neighbor
+         */
+        HaloTransport( MPI_Comm comm, const std::vector<int> &neighbors, const std::vector<std::array<int, 3>> &offsets, const std::vector<long> &send_sizes, const std::vector<long> &recv_sizes )
+            : _comm( comm )
+            , _neighbors( neighbors )
+            , _offsets( offsets )
+            , _send_sizes( send_sizes )
+            , _recv_sizes( recv_sizes ) {
+            for ( long n = 0, send_total = 0, recv_total = 0; n < (long)_neighbors.size(); n++ ) {
+                _send_displs.push_back( send_total );
+                _recv_displs.push_back( recv_total );
+                send_total += _send_sizes[n];
+                recv_total += _recv_sizes[n];
+            }
+        };
+
+        virtual ~HaloTransport() = default;
+
+        /**
+         * Get the Send Buffer of a Neighbor
+         * @param n Neighbor index
+         **/
+        const buffer_view &sendBuffer( const int n ) const { return _send_buffers[n]; };
+
+        /**
+         * Get the Receive Buffer of a Neighbor
+         * @param n Neighbor index
+         **/
+        const buffer_view &recvBuffer( const int n ) const { return _recv_buffers[n]; };
+
+        /**
+         * Prepare to Receive - Called Before the Send Buffers are Packed
+         **/
+        virtual void open(){};
+
+        /**
+         * Start Moving the Packed Send Buffers to the Neighbors
+         **/
+        virtual void start() = 0;
+
+        /**
+         * Wait for the Receive Buffers
+         * @param arrived Called with the index of each neighbor once its receive buffer is valid
+         **/
+        virtual void finish( const std::function<void( int )> &arrived ) = 0;
+
+        /**
+         * Release the Buffers - Called Once the Receive Buffers are Unpacked
+         **/
+        virtual void close(){};
+
+      protected:
+        /**
+         * Allocate the Buffers of Every Neighbor Contiguously
+         * @param send_data Memory to place the send buffers in, or null to allocate it
+         **/
+        void allocate( Scalar *send_data = nullptr ) {
+            long send_total = _neighbors.empty() ? 0 : _send_displs.back() + _send_sizes.back();
+            long recv_total = _neighbors.empty() ? 0 : _recv_displs.back() + _recv_sizes.back();
+
+            _send_data = send_data ? buffer_view( send_data, send_total ) : buffer_view( "halo_send", send_total );
+            _recv_data = buffer_view( "halo_recv", recv_total );
+
+            for ( int n = 0; n < (int)_neighbors.size(); n++ ) {
+                _send_buffers.push_back( buffer_view( _send_data.data() + _send_displs[n], _send_sizes[n] ) );
+                _recv_buffers.push_back( buffer_view( _recv_data.data() + _recv_displs[n], _recv_sizes[n] ) );
+            }
+        }
+
+        /**
+         * Exchange One Value with Every Neighbor
+         * @param local Value sent to each neighbor
+         * @return Value received from each neighbor
+         **/
+        std::vector<long> exchangeValues( const std::vector<long> &local ) const {
+            int                      num_nbrs = _neighbors.size();
+            std::vector<long>        remote( num_nbrs );
+            std::vector<MPI_Request> requests( 2 * num_nbrs );
+
+            for ( int n = 0; n < num_nbrs; n++ ) MPI_Irecv( &remote[n], 1, MPI_LONG, _neighbors[n], tag( _offsets[n], -1 ), _comm, &requests[n] );
+            for ( int n = 0; n < num_nbrs; n++ ) MPI_Isend( &local[n], 1, MPI_LONG, _neighbors[n], tag( _offsets[n], 1 ), _comm, &requests[num_nbrs + n] );
+            MPI_Waitall( 2 * num_nbrs, requests.data(), MPI_STATUSES_IGNORE );
+
+            return remote;
+        }
+
+        /**
+         * Message Tag of a Direction
+         * Ranks may be neighbors in more than one direction on periodic meshes, so the direction is the tag
+         * @param offset Direction of the neighbor
+         * @param sign 1 for a message sent toward the neighbor, -1 for a message received from it
+         **/
+        static int tag( const std::array<int, 3> &offset, const int sign ) {
+            return 9 * ( sign * offset[2] + 1 ) + 3 * ( sign * offset[1] + 1 ) + ( sign * offset[0] + 1 );
+        }
+
+        /**
+         * Size of a Buffer in Bytes
+         **/
+        static int bytes( const long size ) { return size * sizeof( Scalar ); }
+
+        MPI_Comm                        _comm;       /**< MPI communicator */
+        std::vector<int>                _neighbors;  /**< Rank of each neighbor */
+        std::vector<std::array<int, 3>> _offsets;    /**< Direction of each neighbor */
+        std::vector<long>               _send_sizes; /**< Number of values sent to each neighbor */
+        std::vector<long>               _recv_sizes; /**< Number of values received from each neighbor */
+
+        std::vector<long> _send_displs; /**< Offset of each neighbor's send buffer in the send data */
+        std::vector<long> _recv_displs; /**< Offset of each neighbor's receive buffer in the receive data */
+
+        buffer_view              _send_data;    /**< Send buffers of every neighbor */
+        buffer_view              _recv_data;    /**< Receive buffers of every neighbor */
+        std::vector<buffer_view> _send_buffers; /**< Send buffer of each neighbor */
+        std::vector<buffer_view> _recv_buffers; /**< Receive buffer of each neighbor */
+    };
+
+    /**
+ * The MessageTransport Class
+ * @class MessageTransport
+ * @brief Sends one nonblocking message to each neighbor, posting the receives before the send buffers are packed
+ * Receive buffers are handed back in the order their messages arrive
+ **/
+    template <class Scalar, class MemorySpace>
+    class MessageTransport : public HaloTransport<Scalar, MemorySpace> {
+        using base = HaloTransport<Scalar, MemorySpace>;
+
+      public:
+        MessageTransport( MPI_Comm comm, const std::vector<int> &neighbors, const std::vector<std::array<int, 3>> &offsets, const std::vector<long> &send_sizes, const std::vector<long> &recv_sizes )
+            : base( comm, neighbors, offsets, send_sizes, recv_sizes ) {
+            for ( int n = 0; n < (int)neighbors.size(); n++ ) _messages.push_back( n );
+            _requests.assign( 2 * neighbors.size(), MPI_REQUEST_NULL );
+
+            base::allocate();
+        };
+
+        void open() override {
+            for ( auto n : _messages ) MPI_Irecv( base::_recv_buffers[n].data(), base::bytes( base::_recv_sizes[n] ), MPI_BYTE, base::_neighbors[n], base::tag( base::_offsets[n], -1 ), base::_comm, &_requests[n] );
+        };
+
+        void start() override {
+            int num_nbrs = base::_neighbors.size();
+            for ( auto n : _messages ) MPI_Isend( base::_send_buffers[n].data(), base::bytes( base::_send_sizes[n] ), MPI_BYTE, base::_neighbors[n], base::tag( base::_offsets[n], 1 ), base::_comm, &_requests[num_nbrs + n] );
+        };
+
+        void finish( const std::function<void( int )> &arrived ) override {
+            int num_nbrs = base::_neighbors.size();
+            for ( int r = 0; r < (int)_messages.size(); r++ ) {
+                int n;
+                MPI_Waitany( num_nbrs, _requests.data(), &n, MPI_STATUS_IGNORE );
+                arrived( n );
+            }
+        };
+
+        void close() override {
+            // Send Buffers are Reused by the Next Gather
+            int num_nbrs = base::_neighbors.size();
+            MPI_Waitall( num_nbrs, _requests.data() + num_nbrs, MPI_STATUSES_IGNORE );
+        };
+
+      protected:
+        std::vector<int>         _messages; /**< Neighbors exchanged by message */
+        std::vector<MPI_Request> _requests; /**< Receive then send request of each neighbor */
+    };
+
+    /**
+ * The PersistentTransport Class
+ * @class PersistentTransport
+ * @brief Sends one message to each neighbor through persistent requests set up once for the reused buffers
+ **/
+    template <class Scalar, class MemorySpace>
+    class PersistentTransport : public MessageTransport<Scalar, MemorySpace> {
+        using base = MessageTransport<Scalar, MemorySpace>;
+
+      public:
+        PersistentTransport( MPI_Comm comm, const std::vector<int> &neighbors, const std::vector<std::array<int, 3>> &offsets, const std::vector<long> &send_sizes, const std::vector<long> &recv_sizes )
+            : base( comm, neighbors, offsets, send_sizes, recv_sizes ) {
+            int num_nbrs = neighbors.size();
+            for ( int n = 0; n < num_nbrs; n++ ) {
+                MPI_Recv_init( this->_recv_buffers[n].data(), this->bytes( recv_sizes[n] ), MPI_BYTE, neighbors[n], this->tag( offsets[n], -1 ), comm, &this->_requests[n] );
+                MPI_Send_init( this->_send_buffers[n].data(), this->bytes( send_sizes[n] ), MPI_BYTE, neighbors[n], this->tag( offsets[n], 1 ), comm, &this->_requests[num_nbrs + n] );
+            }
+        };
+
+        ~PersistentTransport() {
+            for ( auto &request : this->_requests ) MPI_Request_free( &request );
+        };
+
+        void open() override {
+            int num_nbrs = this->_neighbors.size();
+            if ( num_nbrs ) MPI_Startall( num_nbrs, this->_requests.data() );
+        };
+
+        void start() override {
+            int num_nbrs = this->_neighbors.size();
+            if ( num_nbrs ) MPI_Startall( num_nbrs, this->_requests.data() + num_nbrs );
+        };
+    };
+
+    /**
+ * The NeighborTransport Class
+ * @class NeighborTransport
+ * @brief Exchanges every buffer in one nonblocking neighborhood all-to-all on the Cartesian communicator of the grid
+ * The Cartesian topology only connects face neighbors, so the halo pattern cannot contain diagonal neighbors
+ **/
+    template <class Scalar, class MemorySpace>
+    class NeighborTransport : public HaloTransport<Scalar, MemorySpace> {
+        using base = HaloTransport<Scalar, MemorySpace>;
+
+      public:
+        NeighborTransport( MPI_Comm comm, const std::vector<int> &neighbors, const std::vector<std::array<int, 3>> &offsets, const std::vector<long> &send_sizes, const std::vector<long> &recv_sizes )
+            : base( comm, neighbors, offsets, send_sizes, recv_sizes ) {
+            base::allocate();
+
+            int topology, ndims;
+            MPI_Topo_test( comm, &topology );
+            if ( topology != MPI_CART ) throw std::runtime_error( "Neighborhood collective halo transport needs a Cartesian communicator" );
+            MPI_Cartdim_get( comm, &ndims );
+
+            // Cartesian Neighbors are Ordered by Dimension, Lower Before Upper
+            _counts.assign( 2 * ndims, 0 );
+            _displs.assign( 2 * ndims, 0 );
+            _types.assign( 2 * ndims, MPI_BYTE );
+            _recv_counts = _counts;
+            _recv_displs = _displs;
+
+            for ( int n = 0; n < (int)neighbors.size(); n++ ) {
+                int dim = -1, faces = 0;
+                for ( int d = 0; d < 3; d++ ) {
+                    if ( offsets[n][d] ) dim = d, faces++;
+                }
+                if ( faces != 1 || dim >= ndims ) throw std::runtime_error( "Neighborhood collective halo transport exchanges with face neighbors only" );
+
+                int lower, upper;
+                MPI_Cart_shift( comm, dim, 1, &lower, &upper );
+                int slot = 2 * dim + ( offsets[n][dim] > 0 );
+                if ( ( offsets[n][dim] > 0 ? upper : lower ) != neighbors[n] ) throw std::runtime_error( "Cartesian communicator does not match the grid neighbors" );
+
+                MPI_Aint send_address, recv_address;
+                MPI_Get_address( this->_send_buffers[n].data(), &send_address );
+                MPI_Get_address( this->_recv_buffers[n].data(), &recv_address );
+
+                _counts[slot]      = base::bytes( send_sizes[n] );
+                _displs[slot]      = send_address;
+                _recv_counts[slot] = base::bytes( recv_sizes[n] );
+                _recv_displs[slot] = recv_address;
+            }
+        };
+
+        void start() override {
+            MPI_Ineighbor_alltoallw( MPI_BOTTOM, _counts.data(), _displs.data(), _types.data(), MPI_BOTTOM, _recv_counts.data(), _recv_displs.data(), _types.data(), base::_comm, &_request );
+        };
+
+        void finish( const std::function<void( int )> &arrived ) override {
+            MPI_Wait( &_request, MPI_STATUS_IGNORE );
+            for ( int n = 0; n < (int)base::_neighbors.size(); n++ ) arrived( n );
+        };
+
+      private:
+        std::vector<int>          _counts;                     /**< Bytes sent to each Cartesian neighbor */
+        std::vector<MPI_Aint>     _displs;                     /**< Address of the send buffer of each Cartesian neighbor */
+        std::vector<int>          _recv_counts;                /**< Bytes received from each Cartesian neighbor */
+        std::vector<MPI_Aint>     _recv_displs;                /**< Address of the receive buffer of each Cartesian neighbor */
+        std::vector<MPI_Datatype> _types;                      /**< Byte type of every Cartesian neighbor */
+        MPI_Request               _request = MPI_REQUEST_NULL; /**< Neighborhood collective in flight */
+    };
+
+    /**
+ * The RmaTransport Class
+ * @class RmaTransport
+ * @brief Puts each send buffer straight into the neighbor's receive buffer through a window, synchronized by post-start-complete-wait
+ **/
+    template <class Scalar, class MemorySpace>
+    class RmaTransport : public HaloTransport<Scalar, MemorySpace> {
+        using base = HaloTransport<Scalar, MemorySpace>;
+
+      public:
+        RmaTransport( MPI_Comm comm, const std::vector<int> &neighbors, const std::vector<std::array<int, 3>> &offsets, const std::vector<long> &send_sizes, const std::vector<long> &recv_sizes )
+            : base( comm, neighbors, offsets, send_sizes, recv_sizes ) {
+            base::allocate();
+
+            MPI_Win_create( this->_recv_data.data(), base::bytes( this->_recv_data.size() ), sizeof( Scalar ), MPI_INFO_NULL, comm, &_win );
+
+            // Where Each Neighbor Receives from this Rank
+            _target_displs = base::exchangeValues( this->_recv_displs );
+
+            // Access and Exposure Groups are Both the Neighbors
+            std::vector<int> ranks = neighbors;
+            std::sort( ranks.begin(), ranks.end() );
+            ranks.erase( std::unique( ranks.begin(), ranks.end() ), ranks.end() );
+
+            MPI_Group comm_group;
+            MPI_Comm_group( comm, &comm_group );
+            MPI_Group_incl( comm_group, ranks.size(), ranks.data(), &_group );
+            MPI_Group_free( &comm_group );
+        };
+
+        ~RmaTransport() {
+            MPI_Win_free( &_win );
+            MPI_Group_free( &_group );
+        };
+
+        void open() override { MPI_Win_post( _group, 0, _win ); };
+
+        void start() override {
+            MPI_Win_start( _group, 0, _win );
+            for ( int n = 0; n < (int)base::_neighbors.size(); n++ ) {
+                MPI_Put( this->_send_buffers[n].data(), base::bytes( this->_send_sizes[n] ), MPI_BYTE, this->_neighbors[n], _target_displs[n], base::bytes( this->_send_sizes[n] ), MPI_BYTE, _win );
+            }
+        };
+
+        void finish( const std::function<void( int )> &arrived ) override {
+            MPI_Win_complete( _win );
+            MPI_Win_wait( _win );
+            for ( int n = 0; n < (int)base::_neighbors.size(); n++ ) arrived( n );
+        };
+
+      private:
+        MPI_Win           _win;           /**< Window over the receive buffers */
+        MPI_Group         _group;         /**< Neighbor ranks */
+        std::vector<long> _target_displs; /**< Offset of this rank's receive buffer in each neighbor's window */
+    };
+
+    /**
+ * The SharedTransport Class
+ * @class SharedTransport
+ * @brief Places the send buffers in a node shared memory window so neighbors on the same node unpack straight from them
+ * Neighbors on the same node exchange no message and no copy - their receive buffers alias the neighbors' send buffers
+ * Neighbors on other nodes are exchanged by nonblocking messages
+ **/
+    template <class Scalar, class MemorySpace>
+    class SharedTransport : public MessageTransport<Scalar, MemorySpace> {
+        using base = MessageTransport<Scalar, MemorySpace>;
+
+      public:
+        SharedTransport( MPI_Comm comm, const std::vector<int> &neighbors, const std::vector<std::array<int, 3>> &offsets, const std::vector<long> &send_sizes, const std::vector<long> &recv_sizes )
+            : base( comm, neighbors, offsets, send_sizes, recv_sizes ) {
+            if ( !std::is_same<MemorySpace, Kokkos::HostSpace>::value ) throw std::runtime_error( "Shared memory halo transport needs host memory" );
+
+            MPI_Comm_split_type( comm, MPI_COMM_TYPE_SHARED, 0, MPI_INFO_NULL, &_node_comm );
+
+            // Replace the Send Buffers with the Shared Window
+            Scalar *send_data;
+            MPI_Win_allocate_shared( this->bytes( this->_send_data.size() ), sizeof( Scalar ), MPI_INFO_NULL, _node_comm, &send_data, &_win );
+            MPI_Win_lock_all( MPI_MODE_NOCHECK, _win );
+
+            this->_send_buffers.clear();
+            this->_recv_buffers.clear();
+            this->allocate( send_data );
+
+            // Where Each Neighbor Keeps the Values it Sends to this Rank
+            std::vector<long> source_displs = this->exchangeValues( this->_send_displs );
+
+            std::vector<int> node_ranks( neighbors.size() );
+            MPI_Group        comm_group, node_group;
+            MPI_Comm_group( comm, &comm_group );
+            MPI_Comm_group( _node_comm, &node_group );
+            MPI_Group_translate_ranks( comm_group, neighbors.size(), neighbors.data(), node_group, node_ranks.data() );
+            MPI_Group_free( &comm_group );
+            MPI_Group_free( &node_group );
+
+            // Receive Buffers of Neighbors on this Node Alias their Send Buffers
+            this->_messages.clear();
+            for ( int n = 0; n < (int)neighbors.size(); n++ ) {
+                if ( node_ranks[n] == MPI_UNDEFINED ) {
+                    this->_messages.push_back( n );
+                    continue;
+                }
+
+                MPI_Aint size;
+                int      disp_unit;
+                Scalar * source_data;
+                MPI_Win_shared_query( _win, node_ranks[n], &size, &disp_unit, &source_data );
+
+                this->_recv_buffers[n] = typename base::buffer_view( source_data + source_displs[n], recv_sizes[n] );
+                _direct.push_back( n );
+            }
+        };
+
+        ~SharedTransport() {
+            MPI_Wait( &_released, MPI_STATUS_IGNORE );
+            MPI_Win_unlock_all( _win );
+            MPI_Win_free( &_win );
+            MPI_Comm_free( &_node_comm );
+        };
+
+        void open() override {
+            // Neighbors on this Node Must Finish Reading the Send Buffers Before they are Packed Again
+            MPI_Wait( &_released, MPI_STATUS_IGNORE );
+            base::open();
+        };
+
+        void start() override {
+            MPI_Win_sync( _win );
+            MPI_Ibarrier( _node_comm, &_packed );
+            base::start();
+        };
+
+        void finish( const std::function<void( int )> &arrived ) override {
+            MPI_Wait( &_packed, MPI_STATUS_IGNORE );
+            MPI_Win_sync( _win );
+            for ( auto n : _direct ) arrived( n );
+
+            base::finish( arrived );
+        };
+
+        void close() override {
+            base::close();
+            MPI_Ibarrier( _node_comm, &_released );
+        };
+
+      private:
+        MPI_Comm         _node_comm;                   /**< Ranks sharing memory with this rank */
+        MPI_Win          _win;                         /**< Shared window holding the send buffers */
+        std::vector<int> _direct;                      /**< Neighbors read directly from shared memory */
+        MPI_Request      _packed   = MPI_REQUEST_NULL; /**< Every rank on the node has packed its send buffers */
+        MPI_Request      _released = MPI_REQUEST_NULL; /**< Every rank on the node has unpacked its receive buffers */
+    };
+
+    /**
+ * Creates a Halo Transport
+ *
+ * @param type Halo transport type ( HaloTransportType )
+ * @param comm MPI communicator of the grid
+ * @param neighbors Rank of each neighbor
+ * @param offsets Direction of each neighbor
+ * @param send_sizes Number of values sent to each neighbor
+ * @param recv_sizes Number of values received from each neighbor
+ * @return Shared pointer to the halo transport
+ */
+    template <class Scalar, class MemorySpace>
+    std::shared_ptr<HaloTransport<Scalar, MemorySpace>> createHaloTransport( const int type, MPI_Comm comm, const std::vector<int> &neighbors, const std::vector<std::array<int, 3>> &offsets,
+                                                                             const std::vector<long> &send_sizes, const std::vector<long> &recv_sizes ) {
+        if ( type == HaloTransportType::PERSISTENT )
+            return std::make_shared<PersistentTransport<Scalar, MemorySpace>>( comm, neighbors, offsets, send_sizes, recv_sizes );
+        else if ( type == HaloTransportType::NEIGHBOR )
+            return std::make_shared<NeighborTransport<Scalar, MemorySpace>>( comm, neighbors, offsets, send_sizes, recv_sizes );
+        else if ( type == HaloTransportType::RMA )
+            return std::make_shared<RmaTransport<Scalar, MemorySpace>>( comm, neighbors, offsets, send_sizes, recv_sizes );
+        else if ( type == HaloTransportType::SHARED )
+            return std::make_shared<SharedTransport<Scalar, MemorySpace>>( comm, neighbors, offsets, send_sizes, recv_sizes );
+        else
+            return std::make_shared<MessageTransport<Scalar, MemorySpace>>( comm, neighbors, offsets, send_sizes, recv_sizes );
+    }
+
+} // namespace ExaCLAMR
+
+#endif
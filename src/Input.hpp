@@ -18,15 +18,22 @@
 #endif
 
 // Include Statements
+#include <mpi.h>
+
+#include <array>
 #include <getopt.h>
 #include <iomanip>
 #include <iostream>
 #include <stdlib.h>
+#include <string>
 
 namespace ExaCLAMR {
-    // Short Args: a - Halo Size, b - Mesh Type, d - Domain Size, h - Print Help, g - Gravitational Constant,
-    // m - Threading ( Serial or OpenMP or CUDA ), n - Cell Count, o - Ordering, p - Periodicity, s - Sigma, t - Time Steps, w - Write Frequency,
-    static char *shortargs = (char *)"a::b::d::g::hm::n::o::p::s::t::w::";
+    // Short Args: a - Halo Size, b - Mesh Type, c - Time Step Calculation ( Separate, Fused or Lagged ), d - Domain Size, e - Halo Exchange Interval, f - Precision ( Double, Float or Mixed ), h - Print Help, g - Gravitational Constant, i - Halo Transport ( Nonblocking, Persistent, Neighbor, RMA or Shared ), j - Rebalance Interval, k - Kernel ( Cell, Face, Tiled, or SIMD ), l - Tile Size,
+    // m - Threading ( Serial or OpenMP or CUDA ), n - Cell Count, o - Ordering, p - Periodicity, q - Diagnostic Frequencies, r - Lagged Time Step Safety Factor, s - Sigma, t - Time Steps, u - Cell Traversal ( Index or Storage ), v - AMR Refinement Levels, w - Write Frequency, x - Halo Exchange ( Blocking or Overlap ), y - Rank Decomposition ( Strips, Surface, Node or Hilbert ), z - AMR Neighbor Finding ( Perfect, Compact, Sort or Auto )
+    static char *shortargs = (char *)"a::b::c::d::e::f::g::hi::j::k::l::m::n::o::p::q::r::s::t::u::v::w::x::y::z::";
+
+    // Diagnostic Names in the Order of their Frequencies
+    static const char *diagnostic_names[5] = { "mass", "momentum", "height", "speed", "dt" };
 
     /**
  * @struct ClArgs
@@ -34,20 +41,34 @@ namespace ExaCLAMR {
  */
     template <typename state_t>
     struct ClArgs {
-        int         nx, ny, nz; /**< Number of cells */
-        int         halo_size;  /**< Number of halo cells in each direction */
-        int         time_steps; /**< Number of time steps in simulation */
-        int         write_freq; /**< Write frequency */
-        state_t     hx, hy, hz; /**< Size of the domain */
-        state_t     gravity;    /**< Gravitation constant */
-        state_t     sigma;      /**< Sigma */
-        std::string device;     /**< Threading setting ( Serial, OpenMP, CUDA ) */
-        std::string meshtype;   /**< Mesh Type ( Regular or AMR ) */
-        std::string ordering;   /**< Ordering Type ( Regular or Hilbert ) */
+        int         nx, ny, nz;         /**< Number of cells */
+        int         halo_size;          /**< Number of halo cells in each direction */
+        int         time_steps;         /**< Number of time steps in simulation */
+        int         write_freq;         /**< Write frequency */
+        int         exchange_interval;  /**< Time steps between halo exchanges */
+        int         rebalance_interval; /**< Time steps between load balance measurements ( 0 - Never Rebalance ) */
+        int         amr_levels;         /**< Refinement levels of the AMR mesh above the coarse cells */
+        state_t     hx, hy, hz;         /**< Size of the domain */
+        state_t     gravity;            /**< Gravitation constant */
+        state_t     sigma;              /**< Sigma */
+        state_t     safety;             /**< Safety factor of the lagged time step */
+        std::string device;             /**< Threading setting ( Serial, OpenMP, CUDA ) */
+        std::string meshtype;           /**< Mesh Type ( Regular or AMR ) */
+        std::string ordering;           /**< Ordering Type ( Regular, Hilbert, Morton, Tiled or AoSoA ) */
+        std::string traversal;          /**< Cell traversal of the kernels ( Index - MDRange over i, j, k, or Storage - Along the Storage Order of the Ordering ) */
+        std::string kernel;             /**< Finite volume kernel ( Cell, Face, Tiled, or SIMD ) */
+        std::string timestep;           /**< Time step calculation ( Separate, Fused, or Lagged ) */
+        std::string precision;          /**< Precision ( Double, Float, or Mixed - Float Storage with Double Arithmetic ) */
+        std::string exchange;           /**< Halo exchange ( Blocking or Overlap - Overlapped with Interior Computation ) */
+        std::string transport;          /**< Halo transport ( Nonblocking, Persistent, Neighbor, RMA, or Shared ) */
+        std::string decomposition;      /**< Rank decomposition ( Strips, Surface - Least Halo Surface, Node - Least Surface with Node-Aware Rank Mapping, or Hilbert - Least Surface with Ranks Along a Hilbert Curve ) */
+        std::string neighbor;           /**< AMR neighbor finding ( Perfect Hash, Compact Hash, Sort, or Auto ) */
 
         std::array<int, 3>     global_num_cells;    /**< Globar array of number of cells */
         std::array<state_t, 6> global_bounding_box; /**< Global bounding box of domain */
         std::array<bool, 3>    periodic;            /**< Periodicity of domain */
+        std::array<int, 2>     tile;                /**< Tile size of the tiled kernel */
+        std::array<int, 5>     diagnostic_freq;     /**< Frequency of each diagnostic ( mass, momentum, height, speed, dt ) */
     };
 
     /**
@@ -61,17 +82,41 @@ namespace ExaCLAMR {
             std::cout << "Usage: " << progname << "\n";
             std::cout << std::left << std::setw( 10 ) << "-a" << std::setw( 40 ) << "Halo Size (default 2)" << std::left << "\n";
             std::cout << std::left << std::setw( 10 ) << "-b" << std::setw( 40 ) << "Mesh Type (default Regular)" << std::left << "\n";
+            std::cout << std::left << std::setw( 10 ) << "-c" << std::setw( 40 ) << "Time Step Calculation (default Separate)" << std::left << "\n";
+            std::cout << std::left << std::setw( 20 ) << "  " << std::setw( 50 ) << "-cseparate, -cfused, -clagged (previous time step reduced behind the update)\n";
             std::cout << std::left << std::setw( 10 ) << "-d" << std::setw( 40 ) << "Size of Domain (default 50 50 1)" << std::left << "\n";
+            std::cout << std::left << std::setw( 10 ) << "-e" << std::setw( 40 ) << "Halo Exchange Interval (default 1)" << std::left << "\n";
+            std::cout << std::left << std::setw( 20 ) << "  " << std::setw( 50 ) << "-e4 exchanges a halo of at least 8 cells every 4 time steps\n";
+            std::cout << std::left << std::setw( 10 ) << "-f" << std::setw( 40 ) << "Precision (default Double)" << std::left << "\n";
+            std::cout << std::left << std::setw( 20 ) << "  " << std::setw( 50 ) << "-fdouble, -ffloat, -fmixed (float storage, double arithmetic)\n";
             std::cout << std::left << std::setw( 10 ) << "-h" << std::setw( 40 ) << "Print Help Message" << std::left << "\n";
             std::cout << std::left << std::setw( 10 ) << "-g" << std::setw( 40 ) << "Gravitational Constant (default 9.80)" << std::left << "\n";
+            std::cout << std::left << std::setw( 10 ) << "-i" << std::setw( 40 ) << "Halo Transport (default Nonblocking)" << std::left << "\n";
+            std::cout << std::left << std::setw( 20 ) << "  " << std::setw( 50 ) << "-inonblocking, -ipersistent, -ineighbor (face neighbors only), -irma, -ishared (same-node neighbors read shared memory)\n";
+            std::cout << std::left << std::setw( 10 ) << "-j" << std::setw( 40 ) << "Rebalance Interval (default 0 - never)" << std::left << "\n";
+            std::cout << std::left << std::setw( 10 ) << "-k" << std::setw( 40 ) << "Finite Volume Kernel (default Cell)" << std::left << "\n";
+            std::cout << std::left << std::setw( 10 ) << "-l" << std::setw( 40 ) << "Tile Size (default 16x16)" << std::left << "\n";
             std::cout << std::left << std::setw( 10 ) << "-m" << std::setw( 40 ) << "Thread Setting (default serial)" << std::left << "\n";
             std::cout << std::left << std::setw( 10 ) << "-n" << std::setw( 40 ) << "Number of Cells (default 50 50 1)" << std::left << "\n";
             std::cout << std::left << std::setw( 10 ) << "-o" << std::setw( 40 ) << "Ordering (default Regular)" << std::left << "\n";
+            std::cout << std::left << std::setw( 20 ) << "  " << std::setw( 50 ) << "-oregular, -ohilbert (Hilbert order within tiles of 2^EXACLAMR_HILBERT_TILE_BITS cells, about 6-7x slower than regular), -omorton (Z-order within tiles of 2^EXACLAMR_MORTON_TILE_BITS cells), -otiled (tiles of EXACLAMR_LAYOUT_TILE cells), -oaosoa (height and momentum interleaved in runs of EXACLAMR_AOSOA_VECTOR cells)\n";
             std::cout << std::left << std::setw( 10 ) << "-p" << std::setw( 40 ) << "Periodicity (default: false false false)" << std::left << "\n";
             std::cout << std::left << std::setw( 20 ) << "  " << std::setw( 50 ) << "-p0 (false false false) -p1 (true false false) -p2(false true false) etc\n";
+            std::cout << std::left << std::setw( 10 ) << "-q" << std::setw( 40 ) << "Diagnostic Frequencies (default mass every write)" << std::left << "\n";
+            std::cout << std::left << std::setw( 20 ) << "  " << std::setw( 50 ) << "-qmass=100,momentum=0,height=10,speed=10,dt=1 (0 disables)\n";
+            std::cout << std::left << std::setw( 10 ) << "-r" << std::setw( 40 ) << "Lagged Time Step Safety Factor (default 0.9)" << std::left << "\n";
             std::cout << std::left << std::setw( 10 ) << "-s" << std::setw( 40 ) << "Timestep Sigma Value (default 0.95)" << std::left << "\n";
             std::cout << std::left << std::setw( 10 ) << "-t" << std::setw( 40 ) << "Number of Time Steps (default 3000)" << std::left << "\n";
+            std::cout << std::left << std::setw( 10 ) << "-u" << std::setw( 40 ) << "Cell Traversal (default Storage)" << std::left << "\n";
+            std::cout << std::left << std::setw( 20 ) << "  " << std::setw( 50 ) << "-uindex (MDRange over i, j, k), -ustorage (cells in the storage order of the ordering, one contiguous chunk per thread)\n";
+            std::cout << std::left << std::setw( 10 ) << "-v" << std::setw( 40 ) << "AMR Refinement Levels (default 2)" << std::left << "\n";
             std::cout << std::left << std::setw( 10 ) << "-w" << std::setw( 40 ) << "Write Frequency (default 100)" << std::left << "\n";
+            std::cout << std::left << std::setw( 10 ) << "-x" << std::setw( 40 ) << "Halo Exchange (default Blocking)" << std::left << "\n";
+            std::cout << std::left << std::setw( 20 ) << "  " << std::setw( 50 ) << "-xblocking, -xoverlap (interior cells are updated while the halo is exchanged)\n";
+            std::cout << std::left << std::setw( 10 ) << "-y" << std::setw( 40 ) << "Rank Decomposition (default Surface)" << std::left << "\n";
+            std::cout << std::left << std::setw( 20 ) << "  " << std::setw( 50 ) << "-ystrips, -ysurface (least halo surface), -ynode (least halo surface, ranks renumbered to keep neighbors on a node), -yhilbert (least halo surface, ranks renumbered along a Hilbert curve through the blocks, reports the surface of a Hilbert curve partition of the cells)\n";
+            std::cout << std::left << std::setw( 10 ) << "-z" << std::setw( 40 ) << "AMR Neighbor Finding (default Auto)" << std::left << "\n";
+            std::cout << std::left << std::setw( 20 ) << "  " << std::setw( 50 ) << "-zperfect (hash over the finest level), -zcompact (open-addressing hash), -zsort (sorted keys), -zauto (perfect unless the finest level is sparse)\n";
         }
     }
 
@@ -81,13 +126,13 @@ namespace ExaCLAMR {
  * @param progname The name of the program
  */
     void usage( const int rank, char *progname ) {
-        if ( rank == 0 ) std::cout << "usage: " << progname << " [-a halo-size] [-b mesh-type] [-d size-of-domain] [-g gravity] [-h help]"
-                                   << " [-m threading] [-n number-of-cells] [-o ordering] [-p periodicity] [-s sigma] [-t number-time-steps] [-w write-frequency]\n";
+        if ( rank == 0 ) std::cout << "usage: " << progname << " [-a halo-size] [-b mesh-type] [-c time-step-calculation] [-d size-of-domain] [-e exchange-interval] [-f precision] [-g gravity] [-h help] [-i halo-transport] [-j rebalance-interval]"
+                                   << " [-k kernel] [-l tile-size] [-m threading] [-n number-of-cells] [-o ordering] [-p periodicity] [-q diagnostics] [-r safety-factor] [-s sigma] [-t number-time-steps] [-u traversal] [-v amr-levels] [-w write-frequency] [-x halo-exchange] [-y decomposition] [-z neighbor-finding]\n";
     }
 
     /**
  * Parses command line input and updates the command line variables accordingly.\n
- * Usage: ./[program] [-a halo-size] [-b mesh-type] [-d size-of-domain] [-g gravity] [-h help] [-m threading] [-n number-of-cells] [-o ordering] [-p periodicity] [-s sigma] [-t number-time-steps] [-w write-frequency]
+ * Usage: ./[program] [-a halo-size] [-b mesh-type] [-c time-step-calculation] [-d size-of-domain] [-e exchange-interval] [-f precision] [-g gravity] [-h help] [-i halo-transport] [-j rebalance-interval] [-k kernel] [-l tile-size] [-m threading] [-n number-of-cells] [-o ordering] [-p periodicity] [-q diagnostics] [-r safety-factor] [-s sigma] [-t number-time-steps] [-u traversal] [-v amr-levels] [-w write-frequency] [-x halo-exchange] [-y decomposition] [-z neighbor-finding]
  * @param rank The rank calling the function
  * @param argc Number of command line options passed to program
  * @param argv List of command line options passed to program
@@ -96,8 +141,16 @@ namespace ExaCLAMR {
  */
     template <typename state_t>
     int parseInput( const int rank, const int argc, char **argv, ClArgs<state_t> &cl ) {
-        cl.meshtype = "regular"; // Default Mesh Type
-        cl.ordering = "regular"; // Default Ordering
+        cl.meshtype      = "regular";     // Default Mesh Type
+        cl.ordering      = "regular";     // Default Ordering
+        cl.traversal     = "storage";     // Default Cell Traversal
+        cl.kernel        = "cell";        // Default Finite Volume Kernel
+        cl.timestep      = "separate";    // Default Time Step Calculation
+        cl.precision     = "double";      // Default Precision
+        cl.exchange      = "blocking";    // Default Halo Exchange
+        cl.transport     = "nonblocking"; // Default Halo Transport
+        cl.decomposition = "surface";     // Default Rank Decomposition
+        cl.neighbor      = "auto";        // Default AMR Neighbor Finding
 
         cl.device = "serial";              // Default Thread Setting
         cl.nx = 50, cl.ny = 50, cl.nz = 1; // Default Cell Count
@@ -106,15 +159,25 @@ namespace ExaCLAMR {
 
         cl.periodic = { false, false, false }; // Default Periodicity
 
-        cl.halo_size  = 2;    // Default Halo Size = 2
-        cl.gravity    = 9.80; // Default Gravitational Constant = 9.80
-        cl.sigma      = 0.95; // Default Timestep Sigma Value
-        cl.time_steps = 3000; // Default Time Steps = 3000
-        cl.write_freq = 100;  // Default Write Frequency = 10
+        cl.diagnostic_freq = { -1, 0, 0, 0, 0 }; // Default Diagnostics - Mass every Write Frequency
+
+        cl.tile = { 16, 16 }; // Default Tile Size
+
+        cl.halo_size          = 2;    // Default Halo Size = 2
+        cl.exchange_interval  = 1;    // Default Halo Exchange Every Time Step
+        cl.rebalance_interval = 0;    // Default Fixed Decomposition
+        cl.amr_levels         = 2;    // Default Two Refinement Levels
+        cl.gravity            = 9.80; // Default Gravitational Constant = 9.80
+        cl.sigma              = 0.95; // Default Timestep Sigma Value
+        cl.safety             = 0.9;  // Default Lagged Time Step Safety Factor
+        cl.time_steps         = 3000; // Default Time Steps = 3000
+        cl.write_freq         = 100;  // Default Write Frequency = 10
 
         // Initialize
-        char c;
-        int  periodicval;
+        char        c;
+        int         periodicval;
+        std::string diagnostic, tilestr;
+        size_t      start, end, eq;
 
         // Loop through Command-Line Args
         while ( ( c = getopt( argc, argv, shortargs ) ) != -1 ) {
@@ -135,6 +198,14 @@ namespace ExaCLAMR {
                     return -1;
                 }
                 break;
+            // Time Step Calculation
+            case 'c':
+                cl.timestep = optarg;
+                if ( cl.timestep.compare( "separate" ) && cl.timestep.compare( "fused" ) && cl.timestep.compare( "lagged" ) ) {
+                    if ( rank == 0 ) std::cout << "Valid time step calculation options are: separate, fused, and lagged\n";
+                    return -1;
+                }
+                break;
             // Size of Domain
             case 'd':
                 cl.hx = atof( optarg );
@@ -144,6 +215,22 @@ namespace ExaCLAMR {
                     if ( rank == 0 ) std::cout << "Extent of domain must be a positive number\n";
                 }
                 break;
+            // Halo Exchange Interval
+            case 'e':
+                cl.exchange_interval = atoi( optarg );
+                if ( cl.exchange_interval < 1 ) {
+                    if ( rank == 0 ) std::cout << "Halo exchange interval must be at least 1\n";
+                    return -1;
+                }
+                break;
+            // Precision
+            case 'f':
+                cl.precision = optarg;
+                if ( cl.precision.compare( "double" ) && cl.precision.compare( "float" ) && cl.precision.compare( "mixed" ) ) {
+                    if ( rank == 0 ) std::cout << "Valid precision options are: double, float, and mixed\n";
+                    return -1;
+                }
+                break;
             // Gravitational Constant
             case 'g':
                 cl.gravity = atof( optarg );
@@ -156,6 +243,40 @@ namespace ExaCLAMR {
             case 'h':
                 help( rank, argv[0] );
                 return -1;
+            // Halo Transport
+            case 'i':
+                cl.transport = optarg;
+                if ( cl.transport.compare( "nonblocking" ) && cl.transport.compare( "persistent" ) && cl.transport.compare( "neighbor" ) && cl.transport.compare( "rma" ) && cl.transport.compare( "shared" ) ) {
+                    if ( rank == 0 ) std::cout << "Valid halo transport options are: nonblocking, persistent, neighbor, rma, and shared\n";
+                    return -1;
+                }
+                break;
+            // Rebalance Interval
+            case 'j':
+                cl.rebalance_interval = atoi( optarg );
+                if ( cl.rebalance_interval < 0 ) {
+                    if ( rank == 0 ) std::cout << "Rebalance interval must be non-negative\n";
+                    return -1;
+                }
+                break;
+            // Finite Volume Kernel
+            case 'k':
+                cl.kernel = optarg;
+                if ( cl.kernel.compare( "cell" ) && cl.kernel.compare( "face" ) && cl.kernel.compare( "tiled" ) && cl.kernel.compare( "simd" ) ) {
+                    if ( rank == 0 ) std::cout << "Valid kernel options are: cell, face, tiled, and simd\n";
+                    return -1;
+                }
+                break;
+            // Tile Size
+            case 'l':
+                tilestr = optarg;
+                cl.tile[0] = atoi( tilestr.c_str() );
+                cl.tile[1] = ( tilestr.find( 'x' ) != std::string::npos ) ? atoi( tilestr.substr( tilestr.find( 'x' ) + 1 ).c_str() ) : cl.tile[0];
+                if ( cl.tile[0] < 1 || cl.tile[1] < 1 ) {
+                    if ( rank == 0 ) std::cout << "Tile size must be positive: -l16 or -l32x8\n";
+                    return -1;
+                }
+                break;
             // Threading
             case 'm':
                 cl.device = optarg;
@@ -177,8 +298,8 @@ namespace ExaCLAMR {
             // Ordering
             case 'o':
                 cl.ordering = optarg;
-                if ( cl.ordering.compare( "regular" ) && cl.ordering.compare( "hilbert" ) ) {
-                    if ( rank == 0 ) std::cout << "Valid ordering options are: regular and hilbert\n";
+                if ( cl.ordering.compare( "regular" ) && cl.ordering.compare( "hilbert" ) && cl.ordering.compare( "morton" ) && cl.ordering.compare( "tiled" ) && cl.ordering.compare( "aosoa" ) ) {
+                    if ( rank == 0 ) std::cout << "Valid ordering options are: regular, hilbert, morton, tiled, and aosoa\n";
                     return -1;
                 }
                 break;
@@ -194,6 +315,40 @@ namespace ExaCLAMR {
                     }
                 }
                 break;
+            // Diagnostic Frequencies
+            case 'q':
+                diagnostic = optarg;
+                for ( start = 0; start < diagnostic.size(); start = end + 1 ) {
+                    end = diagnostic.find( ',', start );
+                    if ( end == std::string::npos ) end = diagnostic.size();
+                    eq = diagnostic.find( '=', start );
+                    if ( eq == std::string::npos || eq > end ) {
+                        if ( rank == 0 ) std::cout << "Diagnostics must be given as name=frequency pairs\n";
+                        return -1;
+                    }
+
+                    std::string name = diagnostic.substr( start, eq - start );
+                    int         freq = atoi( diagnostic.substr( eq + 1, end - eq - 1 ).c_str() );
+                    int         d;
+                    for ( d = 0; d < 5; d++ ) {
+                        if ( !name.compare( diagnostic_names[d] ) ) break;
+                    }
+                    if ( d == 5 || freq < 0 ) {
+                        if ( rank == 0 ) std::cout << "Valid diagnostics are: mass, momentum, height, speed, and dt with a non-negative frequency\n";
+                        return -1;
+                    }
+                    cl.diagnostic_freq[d] = freq;
+                }
+                break;
+            // Lagged Time Step Safety Factor
+            case 'r':
+                cl.safety = atof( optarg );
+                // DEBUG: Factors Above 1 Exceed the CFL Limit and Roll Back Every Time Step, which Exercises the Rollback Path
+                if ( cl.safety <= 0.0 || ( cl.safety > 1.0 && !DEBUG ) ) {
+                    if ( rank == 0 ) std::cout << "Safety factor must be a value greater than 0 and at most 1\n";
+                    return -1;
+                }
+                break;
             // Timestep Sigma
             case 's':
                 cl.sigma = atof( optarg );
@@ -206,10 +361,50 @@ namespace ExaCLAMR {
             case 't':
                 cl.time_steps = atoi( optarg );
                 break;
+            // Cell Traversal
+            case 'u':
+                cl.traversal = optarg;
+                if ( cl.traversal.compare( "index" ) && cl.traversal.compare( "storage" ) ) {
+                    if ( rank == 0 ) std::cout << "Valid cell traversal options are: index and storage\n";
+                    return -1;
+                }
+                break;
+            // AMR Refinement Levels
+            case 'v':
+                cl.amr_levels = atoi( optarg );
+                if ( cl.amr_levels < 0 || cl.amr_levels > 16 ) {
+                    if ( rank == 0 ) std::cout << "AMR refinement levels must be between 0 and 16\n";
+                    return -1;
+                }
+                break;
             // Write Frequency
             case 'w':
                 cl.write_freq = atoi( optarg );
                 break;
+            // Halo Exchange
+            case 'x':
+                cl.exchange = optarg;
+                if ( cl.exchange.compare( "blocking" ) && cl.exchange.compare( "overlap" ) ) {
+                    if ( rank == 0 ) std::cout << "Valid halo exchange options are: blocking and overlap\n";
+                    return -1;
+                }
+                break;
+            // Rank Decomposition
+            case 'y':
+                cl.decomposition = optarg;
+                if ( cl.decomposition.compare( "strips" ) && cl.decomposition.compare( "surface" ) && cl.decomposition.compare( "node" ) && cl.decomposition.compare( "hilbert" ) ) {
+                    if ( rank == 0 ) std::cout << "Valid rank decomposition options are: strips, surface, node, and hilbert\n";
+                    return -1;
+                }
+                break;
+            // AMR Neighbor Finding
+            case 'z':
+                cl.neighbor = optarg;
+                if ( cl.neighbor.compare( "perfect" ) && cl.neighbor.compare( "compact" ) && cl.neighbor.compare( "sort" ) && cl.neighbor.compare( "auto" ) ) {
+                    if ( rank == 0 ) std::cout << "Valid neighbor finding options are: perfect, compact, sort, and auto\n";
+                    return -1;
+                }
+                break;
             // Invalid Argument
             case '?':
                 usage( rank, argv[0] );
@@ -217,6 +412,40 @@ namespace ExaCLAMR {
             }
         }
 
+        // Diagnostics Without a Given Frequency Follow the Write Frequency
+        for ( int d = 0; d < 5; d++ ) {
+            if ( cl.diagnostic_freq[d] < 0 ) cl.diagnostic_freq[d] = cl.write_freq;
+        }
+
+        // Halo Must Cover Two Stencil Cells for Every Time Step Between Exchanges
+        if ( cl.halo_size < 2 * cl.exchange_interval ) cl.halo_size = 2 * cl.exchange_interval;
+
+        // Deep Halo Exchanges Reach Diagonal Neighbors, which the Cartesian Neighborhood Collective Cannot
+        if ( !cl.transport.compare( "neighbor" ) && cl.exchange_interval > 1 ) {
+            if ( rank == 0 ) std::cout << "Neighbor halo transport needs a halo exchange interval of 1\n";
+            return -1;
+        }
+
+        // AMR Cells are Not Yet Distributed Across Ranks
+        int comm_size;
+        MPI_Comm_size( MPI_COMM_WORLD, &comm_size );
+        if ( !cl.meshtype.compare( "amr" ) && comm_size > 1 ) {
+            if ( rank == 0 ) std::cout << "The amr mesh type runs on a single rank\n";
+            return -1;
+        }
+
+        // Every Boundary of the AMR Mesh is Reflective
+        if ( !cl.meshtype.compare( "amr" ) && ( cl.periodic[0] || cl.periodic[1] || cl.periodic[2] ) ) {
+            if ( rank == 0 ) std::cout << "The amr mesh type does not support periodic boundaries\n";
+            return -1;
+        }
+
+        // Output and Rebalancing Copy the State Views Between Memory Spaces, which Kokkos Cannot Do for the Non-Contiguous Interleaved Views
+        if ( !cl.ordering.compare( "aosoa" ) && !cl.device.compare( "cuda" ) ) {
+            if ( rank == 0 ) std::cout << "The aosoa ordering is not supported with cuda threading\n";
+            return -1;
+        }
+
         // Set Cell Count and Bounding Box Arrays
         cl.global_num_cells    = { cl.nx, cl.ny, cl.nz };
         cl.global_bounding_box = { 0, 0, 0, cl.hx, cl.hy, cl.hz };
@@ -225,5 +454,50 @@ namespace ExaCLAMR {
         return 0;
     }
 
+    /**
+ * Converts command line arguments to another floating point precision
+ * @param cl Command line arguments to convert
+ * @return Command line arguments with floating point parameters in the new precision
+ */
+    template <typename state_t, typename input_t>
+    ClArgs<state_t> convertClArgs( const ClArgs<input_t> &cl ) {
+        ClArgs<state_t> converted;
+
+        converted.nx                 = cl.nx;
+        converted.ny                 = cl.ny;
+        converted.nz                 = cl.nz;
+        converted.halo_size          = cl.halo_size;
+        converted.time_steps         = cl.time_steps;
+        converted.write_freq         = cl.write_freq;
+        converted.exchange_interval  = cl.exchange_interval;
+        converted.rebalance_interval = cl.rebalance_interval;
+        converted.amr_levels         = cl.amr_levels;
+        converted.hx                 = cl.hx;
+        converted.hy                 = cl.hy;
+        converted.hz                 = cl.hz;
+        converted.gravity            = cl.gravity;
+        converted.sigma              = cl.sigma;
+        converted.safety             = cl.safety;
+        converted.device             = cl.device;
+        converted.meshtype           = cl.meshtype;
+        converted.ordering           = cl.ordering;
+        converted.traversal          = cl.traversal;
+        converted.kernel             = cl.kernel;
+        converted.timestep           = cl.timestep;
+        converted.precision          = cl.precision;
+        converted.exchange           = cl.exchange;
+        converted.transport          = cl.transport;
+        converted.decomposition      = cl.decomposition;
+        converted.neighbor           = cl.neighbor;
+
+        converted.global_num_cells = cl.global_num_cells;
+        for ( int n = 0; n < 6; n++ ) converted.global_bounding_box[n] = cl.global_bounding_box[n];
+        converted.periodic        = cl.periodic;
+        converted.tile            = cl.tile;
+        converted.diagnostic_freq = cl.diagnostic_freq;
+
+        return converted;
+    }
+
 } // namespace ExaCLAMR
 #endif
\ No newline at end of file
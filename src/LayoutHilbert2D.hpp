@@ -0,0 +1,209 @@
+/**
+ * @file
+ * @author Patrick Bridges <pbridges@unm.edu>
+ * @author Jered Dominguez-Trujillo <jereddt@unm.edu>
+ *
+ * @section DESCRIPTION
+ * Hilbert array layout for Kokkos views, replacing the Kokkos fork's LayoutHilbert2D for the solver's -o hilbert ordering
+ * The first two indices of a view are stored in small square tiles, along the Hilbert curve within a tile and row-major from tile to tile
+ * The index within a tile is a single lookup in a table the view offset carries, rather than a walk over every level of the curve
+ */
+
+#ifndef EXACLAMR_LAYOUTHILBERT2D_HPP
+#define EXACLAMR_LAYOUTHILBERT2D_HPP
+
+/**
+ * Bits of the side of the tiles of the Hilbert ordering - at most 4, set at build time
+ */
+#ifndef EXACLAMR_HILBERT_TILE_BITS
+#define EXACLAMR_HILBERT_TILE_BITS 3
+#endif
+
+// Include Statements
+#include <SpaceFillingCurve.hpp>
+#include <StateMirror.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <cstddef>
+#include <type_traits>
+
+namespace ExaCLAMR {
+
+    /**
+ * @struct LayoutHilbert2D
+ * @brief Array layout storing the first two indices along the Hilbert curve through small tiles
+ * Lives in ExaCLAMR rather than Kokkos, so it does not clash with the Kokkos fork's layout of the same name
+ */
+    struct LayoutHilbert2D {
+        typedef LayoutHilbert2D array_layout;
+
+        enum : unsigned { tile_bits = EXACLAMR_HILBERT_TILE_BITS, tile = 1u << EXACLAMR_HILBERT_TILE_BITS };
+
+        size_t dimension[ARRAY_LAYOUT_MAX_RANK];
+
+        enum { is_extent_constructible = true };
+
+        LayoutHilbert2D( LayoutHilbert2D const & ) = default;
+        LayoutHilbert2D( LayoutHilbert2D && )      = default;
+        LayoutHilbert2D &operator=( LayoutHilbert2D const & ) = default;
+        LayoutHilbert2D &operator=( LayoutHilbert2D && ) = default;
+
+        KOKKOS_INLINE_FUNCTION
+        explicit constexpr LayoutHilbert2D( size_t N0 = 0, size_t N1 = 0, size_t N2 = 0, size_t N3 = 0, size_t N4 = 0, size_t N5 = 0, size_t N6 = 0, size_t N7 = 0 )
+            : dimension{ N0, N1, N2, N3, N4, N5, N6, N7 } {}
+    };
+
+} // namespace ExaCLAMR
+
+namespace Kokkos {
+    namespace Impl {
+
+        /**
+ * Offset of the Hilbert Layout
+ * Both extents are padded to whole tiles, so the padding stays below one tile side along each index
+ * Each tile is a contiguous run of the span in Hilbert order and the tiles follow each other in row-major order
+ * The third and later indices select a whole plane of tiles, slowest last
+ */
+        template <class Dimension>
+        struct ViewOffset<Dimension, ExaCLAMR::LayoutHilbert2D, void> {
+            using is_mapping_plugin = std::true_type;
+            using is_regular        = std::false_type;
+
+            typedef size_t                    size_type;
+            typedef Dimension                 dimension_type;
+            typedef ExaCLAMR::LayoutHilbert2D array_layout;
+
+            static const int bits = ExaCLAMR::LayoutHilbert2D::tile_bits;
+
+            dimension_type                                 m_dim;
+            size_type                                      m_tiles; /**< Tiles along the second index */
+            size_type                                      m_plane; /**< Span of the first two indices */
+            ExaCLAMR::SpaceFillingCurve::HilbertTile<bits> m_curve; /**< Hilbert index of the cells of a tile */
+
+            //----------------------------------------
+
+            template <typename I0>
+            KOKKOS_INLINE_FUNCTION size_type operator()( I0 const &i0 ) const {
+                return plane( i0, 0 );
+            }
+
+            template <typename I0, typename I1>
+            KOKKOS_INLINE_FUNCTION size_type operator()( I0 const &i0, I1 const &i1 ) const {
+                return plane( i0, i1 );
+            }
+
+            template <typename I0, typename I1, typename I2>
+            KOKKOS_INLINE_FUNCTION size_type operator()( I0 const &i0, I1 const &i1, I2 const &i2 ) const {
+                return plane( i0, i1 ) + m_plane * i2;
+            }
+
+            template <typename I0, typename I1, typename I2, typename I3>
+            KOKKOS_INLINE_FUNCTION size_type operator()( I0 const &i0, I1 const &i1, I2 const &i2, I3 const &i3 ) const {
+                return plane( i0, i1 ) + m_plane * ( i2 + m_dim.N2 * i3 );
+            }
+
+            template <typename I0, typename I1, typename I2, typename I3, typename I4>
+            KOKKOS_INLINE_FUNCTION size_type operator()( I0 const &i0, I1 const &i1, I2 const &i2, I3 const &i3, I4 const &i4 ) const {
+                return plane( i0, i1 ) + m_plane * ( i2 + m_dim.N2 * ( i3 + m_dim.N3 * i4 ) );
+            }
+
+            //----------------------------------------
+
+            KOKKOS_INLINE_FUNCTION constexpr array_layout layout() const {
+                return array_layout( m_dim.N0, m_dim.N1, m_dim.N2, m_dim.N3, m_dim.N4, m_dim.N5, m_dim.N6, m_dim.N7 );
+            }
+
+            KOKKOS_INLINE_FUNCTION constexpr size_type dimension_0() const { return m_dim.N0; }
+            KOKKOS_INLINE_FUNCTION constexpr size_type dimension_1() const { return m_dim.N1; }
+            KOKKOS_INLINE_FUNCTION constexpr size_type dimension_2() const { return m_dim.N2; }
+            KOKKOS_INLINE_FUNCTION constexpr size_type dimension_3() const { return m_dim.N3; }
+            KOKKOS_INLINE_FUNCTION constexpr size_type dimension_4() const { return m_dim.N4; }
+            KOKKOS_INLINE_FUNCTION constexpr size_type dimension_5() const { return m_dim.N5; }
+            KOKKOS_INLINE_FUNCTION constexpr size_type dimension_6() const { return m_dim.N6; }
+            KOKKOS_INLINE_FUNCTION constexpr size_type dimension_7() const { return m_dim.N7; }
+
+            /* Cardinality of the domain index space */
+            KOKKOS_INLINE_FUNCTION
+            constexpr size_type size() const { return m_dim.N0 * m_dim.N1 * m_dim.N2 * m_dim.N3 * m_dim.N4 * m_dim.N5 * m_dim.N6 * m_dim.N7; }
+
+            /* Span of the range space */
+            KOKKOS_INLINE_FUNCTION
+            constexpr size_type span() const { return m_plane * m_dim.N2 * m_dim.N3 * m_dim.N4 * m_dim.N5 * m_dim.N6 * m_dim.N7; }
+
+            KOKKOS_INLINE_FUNCTION constexpr bool span_is_contiguous() const { return span() == size(); }
+
+            /* Strides of the first two indices are those of the first steps from the corner of a tile */
+            KOKKOS_INLINE_FUNCTION size_type stride_0() const { return m_curve.index( 1, 0 ); }
+            KOKKOS_INLINE_FUNCTION size_type stride_1() const { return m_curve.index( 0, 1 ); }
+            KOKKOS_INLINE_FUNCTION constexpr size_type stride_2() const { return m_plane; }
+            KOKKOS_INLINE_FUNCTION constexpr size_type stride_3() const { return m_plane * m_dim.N2; }
+            KOKKOS_INLINE_FUNCTION constexpr size_type stride_4() const { return m_plane * m_dim.N2 * m_dim.N3; }
+            KOKKOS_INLINE_FUNCTION constexpr size_type stride_5() const { return m_plane * m_dim.N2 * m_dim.N3 * m_dim.N4; }
+            KOKKOS_INLINE_FUNCTION constexpr size_type stride_6() const { return m_plane * m_dim.N2 * m_dim.N3 * m_dim.N4 * m_dim.N5; }
+            KOKKOS_INLINE_FUNCTION constexpr size_type stride_7() const { return m_plane * m_dim.N2 * m_dim.N3 * m_dim.N4 * m_dim.N5 * m_dim.N6; }
+
+            // Stride with [ rank ] value is the total length
+            template <typename iType>
+            KOKKOS_INLINE_FUNCTION void stride( iType *const s ) const {
+                s[0] = stride_0();
+                if ( 1 < dimension_type::rank ) s[1] = stride_1();
+                if ( 2 < dimension_type::rank ) s[2] = stride_2();
+                if ( 3 < dimension_type::rank ) s[3] = stride_3();
+                if ( 4 < dimension_type::rank ) s[4] = stride_4();
+                if ( 5 < dimension_type::rank ) s[5] = stride_5();
+                if ( 6 < dimension_type::rank ) s[6] = stride_6();
+                if ( 7 < dimension_type::rank ) s[7] = stride_7();
+                s[dimension_type::rank] = span();
+            }
+
+            //----------------------------------------
+
+            ViewOffset()                    = default;
+            ViewOffset( const ViewOffset & ) = default;
+            ViewOffset &operator=( const ViewOffset & ) = default;
+
+            template <unsigned TrivialScalarSize>
+            KOKKOS_INLINE_FUNCTION ViewOffset( std::integral_constant<unsigned, TrivialScalarSize> const &, ExaCLAMR::LayoutHilbert2D const &arg_layout )
+                : m_dim( arg_layout.dimension[0], arg_layout.dimension[1], arg_layout.dimension[2], arg_layout.dimension[3], arg_layout.dimension[4], arg_layout.dimension[5], arg_layout.dimension[6], arg_layout.dimension[7] ) {
+                // Whole Tiles Covering Each Extent
+                size_type side = size_type( 1 ) << bits;
+                m_tiles        = ( m_dim.N1 + side - 1 ) >> bits;
+                m_plane        = ( ( m_dim.N0 + side - 1 ) >> bits ) * m_tiles << ( 2 * bits );
+                m_curve.fill();
+            }
+
+            template <class DimRHS>
+            KOKKOS_INLINE_FUNCTION ViewOffset( const ViewOffset<DimRHS, ExaCLAMR::LayoutHilbert2D, void> &rhs )
+                : m_dim( rhs.m_dim.N0, rhs.m_dim.N1, rhs.m_dim.N2, rhs.m_dim.N3, rhs.m_dim.N4, rhs.m_dim.N5, rhs.m_dim.N6, rhs.m_dim.N7 )
+                , m_tiles( rhs.m_tiles )
+                , m_plane( rhs.m_plane )
+                , m_curve( rhs.m_curve ) {
+                static_assert( int( DimRHS::rank ) == int( dimension_type::rank ), "ViewOffset assignment requires equal rank" );
+            }
+
+          private:
+            /**
+             * Offset of ( i, j ) Within the Plane of the First Two Indices
+             **/
+            KOKKOS_INLINE_FUNCTION size_type plane( const size_type i, const size_type j ) const {
+                size_type mask = ( size_type( 1 ) << bits ) - 1;
+                size_type tile = ( i >> bits ) * m_tiles + ( j >> bits );
+                return ( tile << ( 2 * bits ) ) + m_curve.index( i & mask, j & mask );
+            }
+        };
+
+    } // namespace Impl
+} // namespace Kokkos
+
+namespace ExaCLAMR {
+
+    /**
+ * Whole Tiles Pad the Span of the Hilbert Layout
+ */
+    template <>
+    struct LayoutPadded<LayoutHilbert2D> : std::true_type {};
+
+} // namespace ExaCLAMR
+
+#endif
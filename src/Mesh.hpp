@@ -5,6 +5,7 @@
  * 
  * @section DESCRIPTION
  * Mesh class that stores rank, bounding box, domain index spaces and Cajita local grid
+ * The AMR mesh stores the index and refinement level of every cell and refines and coarsens them
  */
 
 #ifndef EXACLAMR_MESH_HPP
@@ -17,13 +18,19 @@
 // Include Statements
 #include <ExaClamrTypes.hpp>
 #include <Input.hpp>
+#include <SpaceFillingCurve.hpp>
 
+#include <Cabana_Core.hpp>
 #include <Cajita.hpp>
 #include <Kokkos_Core.hpp>
 
 #include <mpi.h>
 
+#include <algorithm>
+#include <array>
 #include <memory>
+#include <stdexcept>
+#include <vector>
 
 namespace ExaCLAMR {
 
@@ -37,15 +44,174 @@ namespace ExaCLAMR {
     template <class MeshType, class MemorySpace>
     class Mesh;
 
+    /**
+ * @struct AMRGeometry
+ * @brief Coarse cell size and low corner of an AMR mesh, with the width and center of a cell at any level
+ */
+    template <class state_t>
+    struct AMRGeometry {
+        state_t low_corner[2]; /**< Low corner of the domain */
+        state_t cell_size[2];  /**< Size of a coarse ( level 0 ) cell */
+
+        /**
+         * Width of a Cell Along a Dimension
+         * @param dim Dimension
+         * @param level Refinement level of the cell
+         **/
+        KOKKOS_INLINE_FUNCTION
+        state_t width( const int dim, const int level ) const {
+            return cell_size[dim] / ( 1 << level );
+        };
+
+        /**
+         * Center of a Cell Along a Dimension
+         * @param dim Dimension
+         * @param index Index of the cell at its level
+         * @param level Refinement level of the cell
+         **/
+        KOKKOS_INLINE_FUNCTION
+        state_t center( const int dim, const int index, const int level ) const {
+            return low_corner[dim] + ( index + state_t( 0.5 ) ) * width( dim, level );
+        };
+    };
+
     template <class state_t, class MemorySpace>
     class Mesh<ExaCLAMR::AMRMesh<state_t>, MemorySpace> {
       public:
+        using cell_members = Cabana::MemberTypes<int, int, int>; /**< Index i, index j and refinement level of a cell */
+        using cell_aosoa   = Cabana::AoSoA<cell_members, MemorySpace>;
+        using index_view   = Kokkos::View<int *, MemorySpace>;
+
+        /**
+         * Constructor
+         * Creates the coarse ( level 0 ) cells of the mesh in the order of a Hilbert curve through them
+         * A cell at level l has indices i, j among the cells of width coarse width / 2^l
+         * Refinement puts the four children of a cell where the cell was, in Z order, so siblings stay consecutive
+         * 
+         * @param cl Command line arguments
+         * @param partitioner Cajita MPI partitioner
+         * @param comm MPI communicator
+         */
         Mesh( const ExaCLAMR::ClArgs<state_t> &cl,
               const Cajita::Partitioner &      partitioner,
-              MPI_Comm                         comm ) {
+              MPI_Comm                         comm )
+            : _levels( cl.amr_levels )
+            , _num_cells{ cl.global_num_cells[0], cl.global_num_cells[1] } {
             MPI_Comm_rank( comm, &_rank );
             // DEBUG: Trace Created Mesh
             if ( _rank == 0 && DEBUG ) std::cout << "Created AMR Mesh\n";
+
+            // Cells are Not Yet Distributed Across Ranks - parseInput Rejects the AMR Mesh on More than One Rank
+
+            // Coarse Cell Size
+            for ( int dim = 0; dim < 2; dim++ ) {
+                _geometry.low_corner[dim] = cl.global_bounding_box[dim];
+                _geometry.cell_size[dim]  = ( cl.global_bounding_box[dim + 3] - cl.global_bounding_box[dim] ) / _num_cells[dim];
+            }
+
+            // Coarse Cells Along a Hilbert Curve
+            auto coarse = SpaceFillingCurve::hilbertCells( _num_cells[0], _num_cells[1] );
+
+            _cells       = cell_aosoa( "amr_cells", coarse.size() );
+            auto h_cells = Cabana::create_mirror_view( Kokkos::HostSpace(), _cells );
+            auto h_i     = Cabana::slice<0>( h_cells );
+            auto h_j     = Cabana::slice<1>( h_cells );
+            auto h_level = Cabana::slice<2>( h_cells );
+            for ( size_t n = 0; n < coarse.size(); n++ ) {
+                h_i( n )     = coarse[n][0];
+                h_j( n )     = coarse[n][1];
+                h_level( n ) = 0;
+            }
+            Cabana::deep_copy( _cells, h_cells );
+        };
+
+        /**
+         * Refine and Coarsen Cells
+         * A cell flagged above zero splits into its four children
+         * A cell flagged below zero merges with its three siblings when all four are consecutive, at the same level and flagged
+         * Cells at the finest level are not refined and coarse cells are not coarsened
+         * Every cell counts the cells it becomes and an exclusive prefix sum of the counts places them in the new mesh
+         * @param exec_space Execution space
+         * @param flags Refinement flag of every cell
+         * @return Offset of the first new cell of every old cell, followed by the number of new cells
+         **/
+        template <class ExecutionSpace>
+        index_view adapt( const ExecutionSpace &exec_space, const index_view &flags ) {
+            int  size   = _cells.size();
+            int  levels = _levels;
+            auto i_cell = Cabana::slice<0>( _cells );
+            auto j_cell = Cabana::slice<1>( _cells );
+            auto level  = Cabana::slice<2>( _cells );
+
+            // Cells Each Old Cell Becomes ( 4 - Refined, 1 - Kept or First of Merged Siblings, 0 - Merged into its First Sibling )
+            index_view offsets( "amr_offsets", size + 1 );
+            Kokkos::parallel_for(
+                "AMR_Count", Kokkos::RangePolicy<ExecutionSpace>( exec_space, 0, size ), KOKKOS_LAMBDA( const int n ) {
+                    int l = level( n );
+                    if ( flags( n ) > 0 && l < levels ) {
+                        offsets( n ) = 4;
+                    } else if ( flags( n ) < 0 && l > 0 ) {
+                        int  first = n - ( ( i_cell( n ) & 1 ) + 2 * ( j_cell( n ) & 1 ) );
+                        bool merge = ( first >= 0 && first + 3 < size );
+                        for ( int s = 0; merge && s < 4; s++ ) {
+                            int m = first + s;
+                            merge = ( level( m ) == l && flags( m ) < 0 && ( i_cell( m ) & 1 ) + 2 * ( j_cell( m ) & 1 ) == s && ( i_cell( m ) >> 1 ) == ( i_cell( n ) >> 1 ) && ( j_cell( m ) >> 1 ) == ( j_cell( n ) >> 1 ) );
+                        }
+                        offsets( n ) = ( merge && n != first ) ? 0 : 1;
+                    } else {
+                        offsets( n ) = 1;
+                    }
+                } );
+
+            // Exclusive Prefix Sum - the Entry Past the Last Cell Receives the New Cell Count
+            Kokkos::parallel_scan(
+                "AMR_Offsets", Kokkos::RangePolicy<ExecutionSpace>( exec_space, 0, size + 1 ), KOKKOS_LAMBDA( const int n, int &sum, const bool final ) {
+                    int count = ( n < size ) ? offsets( n ) : 0;
+                    if ( final ) offsets( n ) = sum;
+                    sum += count;
+                } );
+
+            int new_size;
+            Kokkos::deep_copy( new_size, Kokkos::subview( offsets, size ) );
+
+            // Write the New Cells
+            cell_aosoa cells( "amr_cells", new_size );
+            auto       i_new     = Cabana::slice<0>( cells );
+            auto       j_new     = Cabana::slice<1>( cells );
+            auto       level_new = Cabana::slice<2>( cells );
+            Kokkos::parallel_for(
+                "AMR_Adapt", Kokkos::RangePolicy<ExecutionSpace>( exec_space, 0, size ), KOKKOS_LAMBDA( const int n ) {
+                    int m = offsets( n ), count = offsets( n + 1 ) - offsets( n );
+                    if ( count == 4 ) {
+                        for ( int c = 0; c < 4; c++ ) {
+                            i_new( m + c )     = 2 * i_cell( n ) + ( c & 1 );
+                            j_new( m + c )     = 2 * j_cell( n ) + ( c >> 1 );
+                            level_new( m + c ) = level( n ) + 1;
+                        }
+                    } else if ( count == 1 && merged( offsets, size, n ) ) {
+                        i_new( m )     = i_cell( n ) >> 1;
+                        j_new( m )     = j_cell( n ) >> 1;
+                        level_new( m ) = level( n ) - 1;
+                    } else if ( count == 1 ) {
+                        i_new( m )     = i_cell( n );
+                        j_new( m )     = j_cell( n );
+                        level_new( m ) = level( n );
+                    }
+                } );
+
+            _cells = cells;
+            return offsets;
+        };
+
+        /**
+         * Whether an Old Cell is the First of Four Merged Siblings
+         * @param offsets Offsets returned by adapt
+         * @param size Number of old cells
+         * @param n Old cell
+         **/
+        KOKKOS_INLINE_FUNCTION
+        static bool merged( const index_view &offsets, const int size, const int n ) {
+            return n + 1 < size && offsets( n + 1 ) - offsets( n ) == 1 && offsets( n + 2 ) == offsets( n + 1 );
         };
 
         /**
@@ -56,8 +222,48 @@ namespace ExaCLAMR {
             return _rank;
         };
 
+        /**
+         * Returns the Number of Refinement Levels Above the Coarse Cells
+         **/
+        int levels() const {
+            return _levels;
+        };
+
+        /**
+         * Returns the Number of Coarse Cells Along Each Dimension
+         **/
+        const std::array<int, 2> &numCells() const {
+            return _num_cells;
+        };
+
+        /**
+         * Returns the Number of Cells
+         **/
+        int size() const {
+            return _cells.size();
+        };
+
+        /**
+         * Returns the Cells
+         * @return AoSoA of the index i, index j and level of every cell
+         **/
+        const cell_aosoa &cells() const {
+            return _cells;
+        };
+
+        /**
+         * Returns the Geometry of the Cells
+         **/
+        const AMRGeometry<state_t> &geometry() const {
+            return _geometry;
+        };
+
       private:
-        int _rank; /**< Rank of the mesh */
+        int                  _rank;      /**< Rank of the mesh */
+        int                  _levels;    /**< Refinement levels above the coarse cells */
+        std::array<int, 2>   _num_cells; /**< Coarse cells along each dimension */
+        AMRGeometry<state_t> _geometry;  /**< Coarse cell size and low corner */
+        cell_aosoa           _cells;     /**< Index i, index j and level of every cell */
     };
 
     template <class state_t, class MemorySpace>
@@ -67,14 +273,17 @@ namespace ExaCLAMR {
          * Constructor
          * Creates a new mesh and calculates the bounding box, number of cells, and the domain index space.
          * Creates a Cajita Local Grid on each rank as a class member
+         * Blocks split the cells evenly unless block edges are given
          * 
          * @param cl Command line arguments
          * @param partitioner Cajita MPI partitioner
          * @param comm MPI communicator
+         * @param edges Global cell index of every block edge along each dimension, including the halo padding - empty for an even split
          */
-        Mesh( const ExaCLAMR::ClArgs<state_t> &cl,
-              const Cajita::Partitioner &      partitioner,
-              MPI_Comm                         comm )
+        Mesh( const ExaCLAMR::ClArgs<state_t> &      cl,
+              const Cajita::Partitioner &            partitioner,
+              MPI_Comm                               comm,
+              const std::array<std::vector<int>, 3> &edges = {} )
             : _global_bounding_box( cl.global_bounding_box )
             , _ordering( cl.ordering ) {
             MPI_Comm_rank( comm, &_rank );
@@ -135,6 +344,31 @@ namespace ExaCLAMR {
             auto global_mesh = Cajita::createUniformGlobalMesh( global_low_corner, global_high_corner, cell_size );
             auto global_grid = Cajita::createGlobalGrid( comm, global_mesh, cl.periodic, partitioner );
 
+            // Edges of the Even Split - Cajita Gives the Remainder to the Lowest Blocks
+            for ( int dim = 0; dim < 3; dim++ ) {
+                int blocks = global_grid->dimNumBlock( dim ), base = num_cell[dim] / blocks, remainder = num_cell[dim] % blocks;
+                _edges[dim].resize( blocks + 1 );
+                for ( int b = 0; b <= blocks; b++ ) _edges[dim][b] = b * base + std::min( b, remainder );
+            }
+
+            // Uneven Blocks: Cajita Only Splits a Global Mesh Evenly
+            // Every Rank Keeps the Same Global Mesh and Sets the Cells it Owns and their Global Offset Explicitly,
+            // so Global Indices and Periodic Wrap Agree Across Ranks
+            std::array<int, 3> owned_cells, offsets;
+            bool               uneven = false;
+            for ( int dim = 0; dim < 3; dim++ ) {
+                owned_cells[dim] = global_grid->ownedNumCell( dim );
+                offsets[dim]     = global_grid->globalOffset( dim );
+                if ( edges[dim].empty() || edges[dim] == _edges[dim] ) continue;
+
+                int block        = global_grid->dimBlockId( dim );
+                owned_cells[dim] = edges[dim][block + 1] - edges[dim][block];
+                offsets[dim]     = edges[dim][block];
+                _edges[dim]      = edges[dim];
+                uneven           = true;
+            }
+            if ( uneven ) global_grid->setNumCellAndOffset( owned_cells, offsets );
+
             // DEBUG: Print Global Grid Rank, Number of Cells, and Index Offset
             if ( DEBUG ) std::cout << "Global Grid: Rank: " << global_grid->blockId() << "\tNx: " << global_grid->ownedNumCell( 0 ) << "\tNy: " << global_grid->ownedNumCell( 1 ) << "\tNz: " << global_grid->ownedNumCell( 2 ) << "\tOffset x: " << global_grid->globalOffset( 0 ) << "\tOffset y: " << global_grid->globalOffset( 1 ) << "\tOffset z: " << global_grid->globalOffset( 2 ) << "\n";
 
@@ -165,6 +399,16 @@ namespace ExaCLAMR {
             return _local_grid->globalGrid().globalMesh().cellSize( dim );
         };
 
+        /**
+         * Returns the global cell index of every block edge along a dimension, including the halo padding
+         * Block b owns the cells from edge b up to edge b + 1
+         * @param dim Dimension of interest
+         * @return Block edges along the dimension
+         **/
+        const std::vector<int> &blockEdges( int dim ) const {
+            return _edges[dim];
+        };
+
         /**
          * Returns the Cajita Local Grid
          * @return The shared pointer to the Cajita Local Grid
@@ -201,6 +445,101 @@ namespace ExaCLAMR {
             return Cajita::IndexSpace<3>( _domainMin, _domainMax );
         };
 
+        /**
+         * Returns the index space of the domain extended by redundant ghost cells
+         * The domain is only extended toward neighboring ranks, never across a physical boundary
+         * @param depth Number of ghost cells to extend the domain by
+         * @return The index space of the domain and the redundant ghost cells around it
+         **/
+        const Cajita::IndexSpace<3> domainSpace( const int depth ) const {
+            auto owned_cells = _local_grid->indexSpace( Cajita::Own(), Cajita::Cell(), Cajita::Local() );
+
+            std::array<long, 3> min = _domainMin, max = _domainMax;
+
+            // Physical Boundaries Lie Inside the Owned Cells - Only Extend Where the Domain Reaches the Edge of the Owned Cells
+            for ( int dim = 0; dim < 2; dim++ ) {
+                if ( owned_cells.min( dim ) == _domainMin[dim] ) min[dim] -= depth;
+                if ( owned_cells.max( dim ) == _domainMax[dim] ) max[dim] += depth;
+            }
+
+            return Cajita::IndexSpace<3>( min, max );
+        };
+
+        /**
+         * Returns the index space of the domain cells whose stencil reads no ghost cells
+         * The interior is empty in a dimension where the domain is no wider than the stencil
+         * @param width Number of cells the stencil reaches in each direction
+         * @return The index space of the interior of the domain
+         **/
+        const Cajita::IndexSpace<3> interiorSpace( const int width ) const {
+            std::array<long, 3> min = _domainMin, max = _domainMax;
+
+            for ( int dim = 0; dim < 2; dim++ ) {
+                min[dim] = ( _domainMin[dim] + width < _domainMax[dim] ) ? _domainMin[dim] + width : _domainMax[dim];
+                max[dim] = ( _domainMax[dim] - width > min[dim] ) ? _domainMax[dim] - width : min[dim];
+            }
+
+            return Cajita::IndexSpace<3>( min, max );
+        };
+
+        /**
+         * Returns the index space of a strip of the domain, extended by redundant ghost cells, that lies outside the interior
+         * The left and right strips span the extended domain in y, the bottom and top strips span the interior in x
+         * Together with the interior the four strips cover the extended domain exactly once
+         * @param boundary Side of the strip ( 0 - Left, 1 - Bottom, 3 - Right, 4 - Top )
+         * @param width Number of cells the stencil reaches in each direction
+         * @param depth Number of ghost cells the domain is extended by
+         * @return The index space of the strip
+         **/
+        const Cajita::IndexSpace<3> shellSpace( const int boundary, const int width, const int depth ) const {
+            auto domain   = domainSpace( depth );
+            auto interior = interiorSpace( width );
+
+            std::array<long, 3> min = { domain.min( 0 ), domain.min( 1 ), domain.min( 2 ) };
+            std::array<long, 3> max = { domain.max( 0 ), domain.max( 1 ), domain.max( 2 ) };
+            int                 dim = boundary % 3;
+
+            // Bottom and Top Strips Lie Between the Left and Right Strips
+            if ( dim == 1 ) {
+                min[0] = interior.min( 0 );
+                max[0] = interior.max( 0 );
+            }
+
+            if ( boundary < 3 )
+                max[dim] = interior.min( dim );
+            else
+                min[dim] = interior.max( dim );
+
+            return Cajita::IndexSpace<3>( min, max );
+        };
+
+        /**
+         * Returns the index space of a physical boundary strip owned by this rank
+         * The strip is empty if this rank does not own the boundary
+         * @param boundary Boundary ( 0 - Left, 1 - Bottom, 2 - Back, 3 - Right, 4 - Top, 5 - Front )
+         * @param depth Number of redundant ghost cells the strip extends along the boundary
+         * @return The index space of the boundary cells adjacent to the domain
+         **/
+        const Cajita::IndexSpace<3> boundarySpace( const int boundary, const int depth = 0 ) const {
+            auto owned_cells = _local_grid->indexSpace( Cajita::Own(), Cajita::Cell(), Cajita::Local() );
+            auto domain      = domainSpace( depth );
+
+            std::array<long, 3> min = { domain.min( 0 ), domain.min( 1 ), domain.min( 2 ) };
+            std::array<long, 3> max = { domain.max( 0 ), domain.max( 1 ), domain.max( 2 ) };
+            int                 dim = boundary % 3;
+
+            // Lower Boundary Lies Just Below the Domain, Upper Boundary Just Above
+            if ( boundary < 3 ) {
+                min[dim] = _domainMin[dim] - 1;
+                max[dim] = ( owned_cells.min( dim ) <= min[dim] ) ? _domainMin[dim] : min[dim];
+            } else {
+                min[dim] = _domainMax[dim];
+                max[dim] = ( owned_cells.max( dim ) > min[dim] ) ? _domainMax[dim] + 1 : min[dim];
+            }
+
+            return Cajita::IndexSpace<3>( min, max );
+        };
+
         /**
          * Determine whether the cell is on the bottom boundary
          * @param i Index in x-direction
@@ -254,6 +593,7 @@ namespace ExaCLAMR {
         std::shared_ptr<Cajita::LocalGrid<Cajita::UniformMesh<state_t>>> _local_grid;          /**< Cajita Local Grid */
         std::array<long, 3>                                              _domainMin;           /**< Indices of lower corner of domain */
         std::array<long, 3>                                              _domainMax;           /**< Indices of upper corner of domain */
+        std::array<std::vector<int>, 3>                                  _edges;               /**< Block edges along each dimension */
         const std::array<state_t, 6>                                     _global_bounding_box; /**< Array of global bounding box */
         const std::string                                                _ordering;            /**< Mesh ordering */
     };
@@ -0,0 +1,362 @@
+/**
+ * @file
+ * @author Patrick Bridges <pbridges@unm.edu>
+ * @author Jered Dominguez-Trujillo <jereddt@unm.edu>
+ *
+ * @section DESCRIPTION
+ * Neighbors of the cells of an AMR mesh through a spatial hash
+ * Every cell is keyed by its lower left corner at the finest level, which no other cell shares
+ * The neighbor across a side is the cell holding the finest cell just past the lower ( left ) end of the side,
+ * found by probing the key that cell would have at each level
+ * The keys live in a perfect hash over the finest level, a compact open-addressing hash or a sorted array
+ */
+
+#ifndef EXACLAMR_NEIGHBORS_HPP
+#define EXACLAMR_NEIGHBORS_HPP
+
+#ifndef DEBUG
+#define DEBUG 0
+#endif
+
+// Include Statements
+#include <Kokkos_Core.hpp>
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+namespace ExaCLAMR {
+
+    /**
+ * @struct NeighborType
+ * @brief Struct which contains enums of the neighbor finding options
+ */
+    struct NeighborType {
+        enum Values {
+            PERFECT = 0,
+            COMPACT = 1,
+            SORT    = 2,
+            AUTO    = 3
+        };
+    };
+
+    /**
+ * @struct Side
+ * @brief Struct which contains enums of the sides of a cell, in the order of the neighbor arrays
+ */
+    struct Side {
+        enum Values {
+            LEFT   = 0,
+            RIGHT  = 1,
+            BOTTOM = 2,
+            TOP    = 3
+        };
+    };
+
+    /**
+ * The PerfectHash Class
+ * @class PerfectHash
+ * @brief One slot per cell of the finest level
+ * The table is never cleared - a stale slot names a cell whose key the finder checks
+ **/
+    template <class MemorySpace>
+    class PerfectHash {
+      public:
+        typedef Kokkos::View<long *, MemorySpace> key_view;
+
+        /**
+         * Constructor
+         * @param slots Cells of the finest level
+         */
+        PerfectHash( const long slots )
+            : _table( Kokkos::ViewAllocateWithoutInitializing( "perfect_hash" ), slots ) {};
+
+        /**
+         * Insert Every Cell Under its Key
+         **/
+        template <class ExecutionSpace>
+        void insert( const ExecutionSpace &exec_space, const key_view &keys ) {
+            auto table = _table;
+            Kokkos::parallel_for(
+                "Perfect_Hash_Insert", Kokkos::RangePolicy<ExecutionSpace>( exec_space, 0, keys.extent( 0 ) ), KOKKOS_LAMBDA( const int n ) {
+                    table( keys( n ) ) = n;
+                } );
+        };
+
+        /**
+         * Cell Stored Under a Key - May be Stale
+         **/
+        KOKKOS_INLINE_FUNCTION
+        int find( const long key ) const {
+            return _table( key );
+        };
+
+      private:
+        Kokkos::View<int *, MemorySpace> _table; /**< Cell of every finest-level slot */
+    };
+
+    /**
+ * The CompactHash Class
+ * @class CompactHash
+ * @brief Open-addressing hash with linear probing, sized at twice the cells, filled in parallel with atomic compare-and-swap
+ **/
+    template <class MemorySpace>
+    class CompactHash {
+      public:
+        typedef Kokkos::View<long *, MemorySpace> key_view;
+
+        /**
+         * Constructor
+         * @param entries Cells the table has to hold
+         */
+        CompactHash( const long entries ) {
+            int bits = 4;
+            while ( ( 1l << bits ) < 2 * entries ) bits++;
+
+            _bits   = bits;
+            _keys   = Kokkos::View<long *, MemorySpace>( Kokkos::ViewAllocateWithoutInitializing( "compact_hash_keys" ), 1l << bits );
+            _values = Kokkos::View<int *, MemorySpace>( Kokkos::ViewAllocateWithoutInitializing( "compact_hash_values" ), 1l << bits );
+        };
+
+        /**
+         * Cells the Table Holds at Half Occupancy
+         **/
+        long capacity() const {
+            return _keys.extent( 0 ) / 2;
+        };
+
+        /**
+         * Clear the Table and Insert Every Cell Under its Key
+         **/
+        template <class ExecutionSpace>
+        void insert( const ExecutionSpace &exec_space, const key_view &keys ) {
+            Kokkos::deep_copy( _keys, -1l );
+
+            auto table = *this;
+            Kokkos::parallel_for(
+                "Compact_Hash_Insert", Kokkos::RangePolicy<ExecutionSpace>( exec_space, 0, keys.extent( 0 ) ), KOKKOS_LAMBDA( const int n ) {
+                    unsigned long mask = ( 1ul << table._bits ) - 1;
+                    unsigned long slot = table.slot( keys( n ) );
+
+                    // Claim the First Empty Slot Along the Probe Sequence - Keys are Unique
+                    while ( Kokkos::atomic_compare_exchange( &table._keys( slot ), -1l, keys( n ) ) != -1l ) slot = ( slot + 1 ) & mask;
+                    table._values( slot ) = n;
+                } );
+        };
+
+        /**
+         * Cell Stored Under a Key
+         * @return Cell, or -1 if no cell has the key
+         **/
+        KOKKOS_INLINE_FUNCTION
+        int find( const long key ) const {
+            unsigned long mask = ( 1ul << _bits ) - 1;
+            for ( unsigned long slot = this->slot( key );; slot = ( slot + 1 ) & mask ) {
+                long stored = _keys( slot );
+                if ( stored == key ) return _values( slot );
+                if ( stored == -1 ) return -1;
+            }
+        };
+
+      private:
+        /**
+         * First Slot of a Key - Fibonacci Hashing
+         **/
+        KOKKOS_INLINE_FUNCTION
+        unsigned long slot( const long key ) const {
+            return ( (unsigned long)key * 0x9E3779B97F4A7C15ul ) >> ( 64 - _bits );
+        };
+
+        int                               _bits;   /**< Log 2 of the slots */
+        Kokkos::View<long *, MemorySpace> _keys;   /**< Key of every slot ( -1 - Empty ) */
+        Kokkos::View<int *, MemorySpace>  _values; /**< Cell of every slot */
+    };
+
+    /**
+ * The SortedKeys Class
+ * @class SortedKeys
+ * @brief Keys sorted on the host and searched by bisection, as a baseline for the hashes
+ **/
+    template <class MemorySpace>
+    class SortedKeys {
+      public:
+        typedef Kokkos::View<long *, MemorySpace> key_view;
+
+        /**
+         * Sort the Keys of Every Cell
+         **/
+        template <class ExecutionSpace>
+        void insert( const ExecutionSpace &, const key_view &keys ) {
+            long size   = keys.extent( 0 );
+            auto h_keys = Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(), keys );
+
+            std::vector<int> order( size );
+            std::iota( order.begin(), order.end(), 0 );
+            std::sort( order.begin(), order.end(), [&]( const int a, const int b ) { return h_keys( a ) < h_keys( b ); } );
+
+            _keys        = key_view( Kokkos::ViewAllocateWithoutInitializing( "sorted_keys" ), size );
+            _cells       = Kokkos::View<int *, MemorySpace>( Kokkos::ViewAllocateWithoutInitializing( "sorted_cells" ), size );
+            auto h_sort  = Kokkos::create_mirror_view( _keys );
+            auto h_cells = Kokkos::create_mirror_view( _cells );
+            for ( long m = 0; m < size; m++ ) {
+                h_sort( m )  = h_keys( order[m] );
+                h_cells( m ) = order[m];
+            }
+            Kokkos::deep_copy( _keys, h_sort );
+            Kokkos::deep_copy( _cells, h_cells );
+        };
+
+        /**
+         * Cell with a Key
+         * @return Cell, or -1 if no cell has the key
+         **/
+        KOKKOS_INLINE_FUNCTION
+        int find( const long key ) const {
+            long lo = 0, hi = _keys.extent( 0 );
+            while ( lo < hi ) {
+                long mid = ( lo + hi ) / 2;
+                if ( _keys( mid ) < key )
+                    lo = mid + 1;
+                else
+                    hi = mid;
+            }
+            return ( lo < (long)_keys.extent( 0 ) && _keys( lo ) == key ) ? _cells( lo ) : -1;
+        };
+
+      private:
+        key_view                         _keys;  /**< Sorted keys */
+        Kokkos::View<int *, MemorySpace> _cells; /**< Cell of every sorted key */
+    };
+
+    /**
+ * The Neighbors Class
+ * @class Neighbors
+ * @brief Left, right, bottom and top neighbor of every cell of an AMR mesh
+ * A side facing two finer cells has the lower ( left ) one as its neighbor - the other is that cell's top ( right ) neighbor
+ * A side on the domain boundary has the cell itself as its neighbor
+ **/
+    template <class MemorySpace>
+    class Neighbors {
+      public:
+        typedef Kokkos::View<int *[4], MemorySpace> neighbor_view;
+        typedef Kokkos::View<long *, MemorySpace>   key_view;
+
+        /**
+         * Finest Cells per Cell Above Which the Automatic Choice Leaves the Perfect Hash for the Compact One
+         * NeighborBenchmark on a serial host has the perfect hash ahead up to a ratio of about 1400 and even with the compact one near 2700
+         **/
+        static const long perfect_ratio = 2048;
+
+        /**
+         * Constructor
+         * @param type Neighbor finding type
+         * @param num_cells Coarse cells along each dimension
+         * @param levels Refinement levels above the coarse cells
+         */
+        Neighbors( const int type, const std::array<int, 2> &num_cells, const int levels )
+            : _type( type )
+            , _levels( levels )
+            , _fine{ (long)num_cells[0] << levels, (long)num_cells[1] << levels } {};
+
+        /**
+         * Find the Neighbors of Every Cell
+         * @param exec_space Execution space
+         * @param i_cell Index i of every cell at its level
+         * @param j_cell Index j of every cell at its level
+         * @param level Level of every cell
+         * @param size Number of cells
+         **/
+        template <class ExecutionSpace, class ISlice, class JSlice, class LevelSlice>
+        void build( const ExecutionSpace &exec_space, const ISlice &i_cell, const JSlice &j_cell, const LevelSlice &level, const int size ) {
+            // Key of Every Cell - Its Lower Left Corner at the Finest Level
+            key_view keys( Kokkos::ViewAllocateWithoutInitializing( "neighbor_keys" ), size );
+            long     nx = _fine[0], levels = _levels;
+            Kokkos::parallel_for(
+                "Neighbor_Keys", Kokkos::RangePolicy<ExecutionSpace>( exec_space, 0, size ), KOKKOS_LAMBDA( const int n ) {
+                    long shift = levels - level( n );
+                    keys( n )  = ( (long)j_cell( n ) << shift ) * nx + ( (long)i_cell( n ) << shift );
+                } );
+
+            if ( (int)_neighbors.extent( 0 ) != size ) _neighbors = neighbor_view( Kokkos::ViewAllocateWithoutInitializing( "neighbors" ), size );
+
+            int type = _type;
+            if ( type == NeighborType::AUTO ) type = ( _fine[0] * _fine[1] <= perfect_ratio * size ) ? NeighborType::PERFECT : NeighborType::COMPACT;
+
+            if ( type == NeighborType::PERFECT ) {
+                if ( !_perfect ) _perfect = std::make_shared<PerfectHash<MemorySpace>>( _fine[0] * _fine[1] );
+                _perfect->insert( exec_space, keys );
+                find( exec_space, i_cell, j_cell, level, size, *_perfect );
+            } else if ( type == NeighborType::COMPACT ) {
+                if ( !_compact || _compact->capacity() < size ) _compact = std::make_shared<CompactHash<MemorySpace>>( size );
+                _compact->insert( exec_space, keys );
+                find( exec_space, i_cell, j_cell, level, size, *_compact );
+            } else {
+                SortedKeys<MemorySpace> sorted;
+                sorted.insert( exec_space, keys );
+                find( exec_space, i_cell, j_cell, level, size, sorted );
+            }
+        };
+
+        /**
+         * Return Neighbors
+         * @return Left, right, bottom and top neighbor of every cell
+         **/
+        const neighbor_view &view() const {
+            return _neighbors;
+        };
+
+      private:
+        /**
+         * Probe the Keys a Neighbor Could Have, Nearest Levels First
+         **/
+        template <class ExecutionSpace, class ISlice, class JSlice, class LevelSlice, class HashType>
+        void find( const ExecutionSpace &exec_space, const ISlice &i_cell, const JSlice &j_cell, const LevelSlice &level, const int size, const HashType &hash ) {
+            neighbor_view neighbors = _neighbors;
+            long          nx = _fine[0], ny = _fine[1];
+            int           levels = _levels;
+
+            Kokkos::parallel_for(
+                "Neighbor_Find", Kokkos::RangePolicy<ExecutionSpace>( exec_space, 0, size ), KOKKOS_LAMBDA( const int n ) {
+                    int  l     = level( n );
+                    long shift = levels - l;
+                    long x = (long)i_cell( n ) << shift, y = (long)j_cell( n ) << shift;
+
+                    for ( int side = 0; side < 4; side++ ) {
+                        // Finest Cell Just Past the Lower ( Left ) End of the Side
+                        long px = x + ( side == Side::LEFT ? -1 : ( side == Side::RIGHT ? 1l << shift : 0 ) );
+                        long py = y + ( side == Side::BOTTOM ? -1 : ( side == Side::TOP ? 1l << shift : 0 ) );
+
+                        int neighbor = n;
+                        if ( px >= 0 && px < nx && py >= 0 && py < ny ) {
+                            // Levels l, l + 1, l - 1, l + 2, l - 2, ...
+                            for ( int k = 0; k <= 2 * levels; k++ ) {
+                                int lk = l + ( ( k & 1 ) ? ( k + 1 ) / 2 : -( k / 2 ) );
+                                if ( lk < 0 || lk > levels ) continue;
+
+                                long s  = levels - lk;
+                                long cx = ( px >> s ) << s, cy = ( py >> s ) << s;
+                                int  m  = hash.find( cy * nx + cx );
+                                if ( m >= 0 && m < size && level( m ) == lk && ( (long)i_cell( m ) << s ) == cx && ( (long)j_cell( m ) << s ) == cy ) {
+                                    neighbor = m;
+                                    break;
+                                }
+                            }
+                        }
+                        neighbors( n, side ) = neighbor;
+                    }
+                } );
+        };
+
+        int                                       _type;      /**< Neighbor finding type */
+        int                                       _levels;    /**< Refinement levels above the coarse cells */
+        std::array<long, 2>                       _fine;      /**< Finest-level cells along each dimension */
+        neighbor_view                             _neighbors; /**< Neighbors of every cell */
+        std::shared_ptr<PerfectHash<MemorySpace>> _perfect;   /**< Perfect hash, kept between builds */
+        std::shared_ptr<CompactHash<MemorySpace>> _compact;   /**< Compact hash, kept while large enough */
+    };
+
+} // namespace ExaCLAMR
+
+#endif
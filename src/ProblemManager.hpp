@@ -5,6 +5,7 @@
  * 
  * @section DESCRIPTION
  * Problem manager class that stores the mesh and the state data and performs scatters and gathers
+ * The AMR problem manager keeps the state of every cell in an AoSoA and carries it across refinement and coarsening
  */
 
 #ifndef EXACLAMR_PROBLEMMANAGER_HPP
@@ -15,14 +16,20 @@
 #endif
 
 // Include Statements
+#include <CellOrder.hpp>
+#include <CellState.hpp>
 #include <ExaClamrTypes.hpp>
+#include <Halo.hpp>
 #include <Mesh.hpp>
+#include <Neighbors.hpp>
 
 #include <Cabana_Core.hpp>
 #include <Cajita.hpp>
 #include <Kokkos_Core.hpp>
 
+#include <array>
 #include <memory>
+#include <vector>
 
 namespace ExaCLAMR {
 
@@ -68,88 +75,16 @@ namespace ExaCLAMR {
         struct Height {};
 
         /**
- * @struct HxFluxPlus
- * @brief Positive Height X-Direction Flux Field
+ * @struct XFlux
+ * @brief X-Face Flux and Flux Corrector Field
  **/
-        struct HxFluxPlus {};
+        struct XFlux {};
 
         /**
- * @struct HxFluxMinus
- * @brief Negative Height X-Direction Flux Field
+ * @struct YFlux
+ * @brief Y-Face Flux and Flux Corrector Field
  **/
-        struct HxFluxMinus {};
-
-        /**
- * @struct UxFluxPlus
- * @brief Positive Momentum X-Direction Flux Field
- **/
-        struct UxFluxPlus {};
-
-        /**
- * @struct UxFluxMinus
- * @brief Negative Momentum X-Direction Flux Field
- **/
-        struct UxFluxMinus {};
-
-        /**
- * @struct HyFluxPlus
- * @brief Positive Height Y-Direction Flux Field
- **/
-        struct HyFluxPlus {};
-
-        /**
- * @struct HyFluxMinus
- * @brief Negative Height Y-Direction Flux Field
- **/
-        struct HyFluxMinus {};
-
-        /**
- * @struct UyFluxPlus
- * @brief Positive Momentum Y-Direction Flux Field
- **/
-        struct UyFluxPlus {};
-
-        /**
- * @struct UyFluxMinus
- * @brief Negative Momentum Y-Direction Flux Field
- **/
-        struct UyFluxMinus {};
-
-        /**
- * @struct HxWPlus
- * @brief Positive X-Direction Height Flux Corrector Field
- **/
-        struct HxWPlus {};
-
-        /**
- * @struct HxWMinus
- * @brief Negative X-Direction Height Flux Corrector Field
- **/
-        struct HxWMinus {};
-
-        /**
- * @struct HyWPlus
- * @brief Positive Y-Direction Height Flux Corrector Field
- **/
-        struct HyWPlus {};
-
-        /**
- * @struct HyWMinus
- * @brief Negative Y-Direction Height Flux Corrector Field
- **/
-        struct HyWMinus {};
-
-        /**
- * @struct UWPlus
- * @brief Positive Momentum Flux Corrector Field
- **/
-        struct UWPlus {};
-
-        /**
- * @struct UWMinus
- * @brief Negative Momentum Flux Corrector Field
- **/
-        struct UWMinus {};
+        struct YFlux {};
     } // namespace Field
 
     /**
@@ -162,13 +97,17 @@ namespace ExaCLAMR {
 
     template <class state_t, class MemorySpace, class ExecutionSpace, class OrderingView>
     class ProblemManager<ExaCLAMR::AMRMesh<state_t>, MemorySpace, ExecutionSpace, OrderingView> {
-        using cell_members = Cabana::MemberTypes<state_t[3], state_t[3], state_t[3][3]>;
+        using mesh_type       = Mesh<ExaCLAMR::AMRMesh<state_t>, MemorySpace>;
+        using index_view      = typename mesh_type::index_view;
+        using cell_members    = Cabana::MemberTypes<state_t, state_t[2]>; /**< Height and momentum of a cell */
+        using state_aosoa     = Cabana::AoSoA<cell_members, MemorySpace>;
+        using neighbor_finder = Neighbors<MemorySpace>;
 
       public:
         /**
          * Constructor
          * Creates a new mesh
-         * Creates state cell layouts, halo layouts, and Cajita arrays to store state data
+         * Refines the mesh where the initial state varies and creates the state AoSoAs
          * Initializes state data
          * 
          * @param cl Command line arguments
@@ -180,42 +119,266 @@ namespace ExaCLAMR {
         template <class InitFunc>
         ProblemManager( const ExaCLAMR::ClArgs<state_t> &cl, const Cajita::Partitioner &partitioner, MPI_Comm comm, const InitFunc &create_functor ) {
             // Create Mesh
-            _mesh = std::make_shared<Mesh<ExaCLAMR::AMRMesh<state_t>, MemorySpace>>( cl, partitioner, comm );
+            _mesh = std::make_shared<mesh_type>( cl, partitioner, comm );
 
             // trace Create Problem Manager
             if ( DEBUG && _mesh->rank() == 0 ) std::cout << "Created AMR ProblemManager\n";
 
+            // Neighbor Finding
+            int type = NeighborType::AUTO;
+            if ( !cl.neighbor.compare( "perfect" ) )
+                type = NeighborType::PERFECT;
+            else if ( !cl.neighbor.compare( "compact" ) )
+                type = NeighborType::COMPACT;
+            else if ( !cl.neighbor.compare( "sort" ) )
+                type = NeighborType::SORT;
+            _neighbors = std::make_shared<neighbor_finder>( type, _mesh->numCells(), _mesh->levels() );
+
             initialize( create_functor );
         }
 
         /**
          * Initializes state values in the cells
+         * The mesh is refined one level at a time wherever the initialization function differs across the quadrants of a cell,
+         * and wherever needed to keep neighbors within one level of each other
+         * The coordinates passed to the function are the index i, index j and level of the cell
          * @param create_functor Initialization function
          **/
         template <class InitFunctor>
-        void initialize( const InitFunctor &create_functor ){
+        void initialize( const InitFunctor &create_functor ) {
+            // DEBUG: Trace State Initialization
+            if ( _mesh->rank() == 0 && DEBUG ) std::cout << "Initializing Cell Fields\n";
+
+            auto geometry = _mesh->geometry();
+
+            for ( int pass = 0; pass <= _mesh->levels(); pass++ ) {
+                findNeighbors();
+
+                int  size   = _mesh->size();
+                auto i_cell = Cabana::slice<0>( _mesh->cells() );
+                auto j_cell = Cabana::slice<1>( _mesh->cells() );
+                auto level  = Cabana::slice<2>( _mesh->cells() );
+
+                _state_a = state_aosoa( "amr_state", size );
+                _state_b = state_aosoa( "amr_state", size );
+
+                auto h_a = get( Location::Cell(), Field::Height(), 0 );
+                auto u_a = get( Location::Cell(), Field::Momentum(), 0 );
+                auto h_b = get( Location::Cell(), Field::Height(), 1 );
+                auto u_b = get( Location::Cell(), Field::Momentum(), 1 );
+
+                index_view flags( "amr_flags", size );
+                Kokkos::parallel_for(
+                    "Initializing", Kokkos::RangePolicy<ExecutionSpace>( 0, size ), KOKKOS_LAMBDA( const int n ) {
+                        // Initialize State Vectors
+                        state_t momentum[2];
+                        state_t height;
+
+                        // Coordinates of the Cell Center
+                        int     coords[3] = { i_cell( n ), j_cell( n ), level( n ) };
+                        state_t x[3]      = { geometry.center( 0, coords[0], coords[2] ), geometry.center( 1, coords[1], coords[2] ), 0.5 };
+
+                        // Initialization Function
+                        create_functor( coords, x, momentum, height );
+
+                        // Assign Values to State Slices
+                        u_a( n, 0 ) = momentum[0];
+                        u_a( n, 1 ) = momentum[1];
+                        h_a( n )    = height;
+
+                        u_b( n, 0 ) = momentum[0];
+                        u_b( n, 1 ) = momentum[1];
+                        h_b( n )    = height;
+
+                        // Refine if the Height at a Quadrant Center Differs from the Height at the Cell Center
+                        int refine = 0;
+                        for ( int q = 0; q < 4; q++ ) {
+                            state_t xq[3] = { x[0] + ( ( q & 1 ) - state_t( 0.5 ) ) * geometry.width( 0, coords[2] + 1 ), x[1] + ( ( q >> 1 ) - state_t( 0.5 ) ) * geometry.width( 1, coords[2] + 1 ), x[2] };
+                            state_t mq[2], hq;
+                            create_functor( coords, xq, mq, hq );
+                            if ( hq != height ) refine = 1;
+                        }
+                        flags( n ) = refine;
+                    } );
+
+                // The Last Pass Only Sets the State
+                if ( pass < _mesh->levels() ) {
+                    balance( flags );
+                    _mesh->adapt( ExecutionSpace(), flags );
+                }
+            }
+        };
+
+        /**
+         * Refine and Coarsen the Mesh and Carry the State of a Time Level Over
+         * Children take the height and momentum of their parent and a parent the average of its four children,
+         * so the total mass and momentum are unchanged
+         * The other time level is resized and left for the next time step to overwrite
+         * Flags are first balanced so neighbors stay within one level, and the neighbors are found again afterwards
+         * @param flags Refinement flag of every cell ( 1 - Refine, -1 - Coarsen, 0 - Keep )
+         * @param t Toggle between state AoSoAs holding the current state
+         **/
+        void adapt( const index_view &flags, int t ) {
+            balance( flags );
 
+            int  size    = _mesh->size();
+            auto offsets = _mesh->adapt( ExecutionSpace(), flags );
+
+            state_aosoa state( "amr_state", _mesh->size() );
+
+            auto h_old = get( Location::Cell(), Field::Height(), t );
+            auto u_old = get( Location::Cell(), Field::Momentum(), t );
+            auto h_new = Cabana::slice<0>( state );
+            auto u_new = Cabana::slice<1>( state );
+
+            Kokkos::parallel_for(
+                "AMR_Remap", Kokkos::RangePolicy<ExecutionSpace>( 0, size ), KOKKOS_LAMBDA( const int n ) {
+                    int m = offsets( n ), count = offsets( n + 1 ) - offsets( n );
+                    if ( count == 4 ) {
+                        // Prolongation - Children Cover the Parent
+                        for ( int c = 0; c < 4; c++ ) {
+                            h_new( m + c )    = h_old( n );
+                            u_new( m + c, 0 ) = u_old( n, 0 );
+                            u_new( m + c, 1 ) = u_old( n, 1 );
+                        }
+                    } else if ( count == 1 && mesh_type::merged( offsets, size, n ) ) {
+                        // Restriction - Parent Holds the Mean of its Four Children
+                        h_new( m )    = 0.25 * ( h_old( n ) + h_old( n + 1 ) + h_old( n + 2 ) + h_old( n + 3 ) );
+                        u_new( m, 0 ) = 0.25 * ( u_old( n, 0 ) + u_old( n + 1, 0 ) + u_old( n + 2, 0 ) + u_old( n + 3, 0 ) );
+                        u_new( m, 1 ) = 0.25 * ( u_old( n, 1 ) + u_old( n + 1, 1 ) + u_old( n + 2, 1 ) + u_old( n + 3, 1 ) );
+                    } else if ( count == 1 ) {
+                        h_new( m )    = h_old( n );
+                        u_new( m, 0 ) = u_old( n, 0 );
+                        u_new( m, 1 ) = u_old( n, 1 );
+                    }
+                } );
+
+            if ( t == 0 ) {
+                _state_a = state;
+                _state_b = state_aosoa( "amr_state", _mesh->size() );
+            } else {
+                _state_a = state_aosoa( "amr_state", _mesh->size() );
+                _state_b = state;
+            }
+
+            findNeighbors();
+        };
+
+        /**
+         * Limit Refinement Flags so Neighbors Differ by at Most One Level After Adapting
+         * A cell refines when a neighbor may end up two levels finer, and keeps its level when a neighbor may end up finer than it is now
+         * Flags only rise, so the sweeps repeat until no flag changes
+         * Each sweep reads the flags of the last sweep and writes a second buffer, so no cell reads a flag another thread writes
+         * @param flags Refinement flag of every cell ( 1 - Refine, -1 - Coarsen, 0 - Keep )
+         **/
+        void balance( const index_view &flags ) const {
+            int  size      = _mesh->size();
+            int  levels    = _mesh->levels();
+            auto level     = Cabana::slice<2>( _mesh->cells() );
+            auto neighbors = _neighbors->view();
+
+            index_view next( Kokkos::ViewAllocateWithoutInitializing( "amr_balance_flags" ), size );
+
+            int changes;
+            do {
+                changes = 0;
+                Kokkos::parallel_reduce(
+                    "AMR_Balance", Kokkos::RangePolicy<ExecutionSpace>( 0, size ), KOKKOS_LAMBDA( const int n, int &lchanges ) {
+                        int l    = level( n );
+                        int flag = flags( n );
+                        for ( int side = 0; side < 4; side++ ) {
+                            // Both Finer Neighbors Across a Side - the Second is the Top ( Right ) Neighbor of the First
+                            int m = neighbors( n, side );
+                            for ( int f = 0; f < 2 && m != n; f++ ) {
+                                int target = level( m ) + ( flags( m ) > 0 ? 1 : 0 );
+                                if ( flag < 0 && target > l ) {
+                                    flag = 0;
+                                    lchanges++;
+                                }
+                                if ( flag == 0 && l < levels && target > l + 1 ) {
+                                    flag = 1;
+                                    lchanges++;
+                                }
+                                m = ( level( m ) > l ) ? neighbors( m, side < 2 ? Side::TOP : Side::RIGHT ) : n;
+                            }
+                        }
+                        next( n ) = flag;
+                    },
+                    changes );
+                Kokkos::deep_copy( flags, next );
+            } while ( changes > 0 );
+        };
+
+        /**
+         * Find the Neighbors of Every Cell of the Current Mesh
+         **/
+        void findNeighbors() {
+            auto cells = _mesh->cells();
+            _neighbors->build( ExecutionSpace(), Cabana::slice<0>( cells ), Cabana::slice<1>( cells ), Cabana::slice<2>( cells ), _mesh->size() );
         };
 
         /**
          * Return mesh
          * @return Returns Mesh object
          **/
-        const std::shared_ptr<Mesh<ExaCLAMR::AMRMesh<state_t>, MemorySpace>> &mesh() const {
+        const std::shared_ptr<mesh_type> &mesh() const {
             return _mesh;
         };
 
+        /**
+         * Return Neighbors
+         * @return Left, right, bottom and top neighbor of every cell
+         **/
+        const typename neighbor_finder::neighbor_view &neighbors() const {
+            return _neighbors->view();
+        };
+
+        /**
+         * Return Momentum Field
+         * @param Location::Cell
+         * @param Field::Momentum
+         * @param t Toggle between state AoSoAs
+         * @return Returns Momentum slice of the cells
+         **/
+        typename state_aosoa::template member_slice_type<1> get( Location::Cell, Field::Momentum, int t ) const {
+            if ( t == 0 )
+                return Cabana::slice<1>( _state_a );
+            else
+                return Cabana::slice<1>( _state_b );
+        };
+
+        /**
+         * Return Height Field
+         * @param Location::Cell
+         * @param Field::Height
+         * @param t Toggle between state AoSoAs
+         * @return Returns Height slice of the cells
+         **/
+        typename state_aosoa::template member_slice_type<0> get( Location::Cell, Field::Height, int t ) const {
+            if ( t == 0 )
+                return Cabana::slice<0>( _state_a );
+            else
+                return Cabana::slice<0>( _state_b );
+        };
+
       private:
-        Cabana::AoSoA<cell_members, MemorySpace> _cells;
+        state_aosoa _state_a; /**< Height and momentum of the cells 1 */
+        state_aosoa _state_b; /**< Height and momentum of the cells 2 */
 
-        std::shared_ptr<Mesh<ExaCLAMR::AMRMesh<state_t>, MemorySpace>> _mesh; /**< Mesh object */
+        std::shared_ptr<mesh_type>       _mesh;      /**< Mesh object */
+        std::shared_ptr<neighbor_finder> _neighbors; /**< Neighbors of the cells */
     };
 
-    template <class state_t, class MemorySpace, class ExecutionSpace, class OrderingView>
-    class ProblemManager<ExaCLAMR::RegularMesh<state_t>, MemorySpace, ExecutionSpace, OrderingView> {
-        using cell_array  = Cajita::Array<state_t, Cajita::Cell, Cajita::UniformMesh<state_t>, OrderingView, MemorySpace>;
-        using halo        = Cajita::Halo<MemorySpace>;
-        using device_type = Kokkos::Device<ExecutionSpace, MemorySpace>;
+    template <class state_t, class storage_t, class MemorySpace, class ExecutionSpace, class OrderingView>
+    class ProblemManager<ExaCLAMR::RegularMesh<state_t, storage_t>, MemorySpace, ExecutionSpace, OrderingView> {
+        using cell_storage = CellStorage<storage_t, OrderingView, Cajita::UniformMesh<state_t>, MemorySpace>;
+        using cell_array   = typename cell_storage::array_type;
+        using x_face_array = Cajita::Array<state_t, Cajita::Face<Cajita::Dim::I>, Cajita::UniformMesh<state_t>, OrderingView, MemorySpace>;
+        using y_face_array = Cajita::Array<state_t, Cajita::Face<Cajita::Dim::J>, Cajita::UniformMesh<state_t>, OrderingView, MemorySpace>;
+        using halo         = Cajita::Halo<MemorySpace>;
+        using packed_halo  = PackedHalo<storage_t, MemorySpace>;
+        using cell_order   = CellOrder<typename cell_array::view_type>;
+        using device_type  = Kokkos::Device<ExecutionSpace, MemorySpace>;
 
       public:
         /**
@@ -231,9 +394,26 @@ namespace ExaCLAMR {
          */
 
         template <class InitFunc>
-        ProblemManager( const ExaCLAMR::ClArgs<state_t> &cl, const Cajita::Partitioner &partitioner, MPI_Comm comm, const InitFunc &create_functor ) {
+        ProblemManager( const ExaCLAMR::ClArgs<state_t> &cl, const Cajita::Partitioner &partitioner, MPI_Comm comm, const InitFunc &create_functor )
+            : ProblemManager( cl, partitioner, comm, std::array<std::vector<int>, 3>() ) {
+            // Initialize State Values ( Height, Momentum )
+            initialize( create_functor );
+        };
+
+        /**
+         * Constructor
+         * Creates a new mesh split at the given block edges
+         * Creates state cell layouts, halo layouts, and Cajita arrays to store state data
+         * State data is left uninitialized to be filled by the caller, e.g. when migrating state to a new decomposition
+         * 
+         * @param cl Command line arguments
+         * @param partitioner Cajita MPI partitioner
+         * @param comm MPI communicator
+         * @param edges Global cell index of every block edge along each dimension - empty for an even split
+         */
+        ProblemManager( const ExaCLAMR::ClArgs<state_t> &cl, const Cajita::Partitioner &partitioner, MPI_Comm comm, const std::array<std::vector<int>, 3> &edges ) {
             // Create Mesh
-            _mesh = std::make_shared<Mesh<ExaCLAMR::RegularMesh<state_t>, MemorySpace>>( cl, partitioner, comm );
+            _mesh = std::make_shared<Mesh<ExaCLAMR::RegularMesh<state_t>, MemorySpace>>( cl, partitioner, comm, edges );
 
             // Trace Create Problem Manager
             if ( DEBUG && _mesh->rank() == 0 ) std::cout << "Created Regular ProblemManager\n";
@@ -242,42 +422,32 @@ namespace ExaCLAMR {
             auto cell_vector_layout = Cajita::createArrayLayout( _mesh->localGrid(), 2, Cajita::Cell() ); // 2-Dimensional ( Momentum )
             auto cell_scalar_layout = Cajita::createArrayLayout( _mesh->localGrid(), 1, Cajita::Cell() );
 
-            // Initialize State Arrays
+            // Initialize State Arrays in the Storage Precision
             // A and B Arrays used to Update State Data without Overwriting
-            _momentum_a = Cajita::createArray<state_t, OrderingView, MemorySpace>( "momentum", cell_vector_layout );
-            _height_a   = Cajita::createArray<state_t, OrderingView, MemorySpace>( "height", cell_scalar_layout );
-
-            _momentum_b = Cajita::createArray<state_t, OrderingView, MemorySpace>( "momentum", cell_vector_layout );
-            _height_b   = Cajita::createArray<state_t, OrderingView, MemorySpace>( "height", cell_scalar_layout );
-
-            // Initialize Flux Arrays
-            _hx_flux_plus  = Cajita::createArray<state_t, OrderingView, MemorySpace>( "HxFluxPlus", cell_scalar_layout );
-            _hx_flux_minus = Cajita::createArray<state_t, OrderingView, MemorySpace>( "HxFluxMinus", cell_scalar_layout );
-            _ux_flux_plus  = Cajita::createArray<state_t, OrderingView, MemorySpace>( "UxFluxPlus", cell_vector_layout );
-            _ux_flux_minus = Cajita::createArray<state_t, OrderingView, MemorySpace>( "UxFluxMinus", cell_vector_layout );
-
-            _hy_flux_plus  = Cajita::createArray<state_t, OrderingView, MemorySpace>( "HyFluxPlus", cell_scalar_layout );
-            _hy_flux_minus = Cajita::createArray<state_t, OrderingView, MemorySpace>( "HyFluxMinus", cell_scalar_layout );
-            _uy_flux_plus  = Cajita::createArray<state_t, OrderingView, MemorySpace>( "UyFluxPlus", cell_vector_layout );
-            _uy_flux_minus = Cajita::createArray<state_t, OrderingView, MemorySpace>( "UyFluxMinus", cell_vector_layout );
-
-            // Initialize Flux Corrector Arrays
-            _hx_w_plus  = Cajita::createArray<state_t, OrderingView, MemorySpace>( "HxWPlus", cell_scalar_layout );
-            _hx_w_minus = Cajita::createArray<state_t, OrderingView, MemorySpace>( "HxWMinus", cell_scalar_layout );
-            _hy_w_plus  = Cajita::createArray<state_t, OrderingView, MemorySpace>( "HyWPlus", cell_scalar_layout );
-            _hy_w_minus = Cajita::createArray<state_t, OrderingView, MemorySpace>( "HyWMinus", cell_scalar_layout );
-
-            _u_w_plus  = Cajita::createArray<state_t, OrderingView, MemorySpace>( "UWPlus", cell_vector_layout );
-            _u_w_minus = Cajita::createArray<state_t, OrderingView, MemorySpace>( "UWMinus", cell_vector_layout );
+            // The Interleaved Ordering Keeps Height and Momentum of a Time Level in One AoSoA
+            cell_storage::create( cell_vector_layout, cell_scalar_layout, _momentum_a, _height_a );
+            cell_storage::create( cell_vector_layout, cell_scalar_layout, _momentum_b, _height_b );
+
+            // Initialize Face Flux Arrays for the Face-Based Kernel - Intermediate Values Kept in the Compute Precision
+            // Dofs: Height Flux, Normal Momentum Flux, Tangential Momentum Flux, Height Corrector, Normal Momentum Corrector
+            if ( !cl.kernel.compare( "face" ) ) {
+                auto x_face_layout = Cajita::createArrayLayout( _mesh->localGrid(), 5, Cajita::Face<Cajita::Dim::I>() );
+                auto y_face_layout = Cajita::createArrayLayout( _mesh->localGrid(), 5, Cajita::Face<Cajita::Dim::J>() );
+
+                _x_flux = Cajita::createArray<state_t, OrderingView, MemorySpace>( "XFlux", x_face_layout );
+                _y_flux = Cajita::createArray<state_t, OrderingView, MemorySpace>( "YFlux", y_face_layout );
+            }
 
             // Create Halo Pattern
             auto                            halo_pattern = Cajita::HaloPattern();
             std::vector<std::array<int, 3>> neighbors;
 
             // Setting up Stencil ( Left, Right, Top, Bottom )
+            // Redundant Updates Between Deep Halo Exchanges Reach the Corners of the Halo - Add the Diagonal Neighbors
+            bool corners = ( cl.exchange_interval > 1 );
             for ( int i = -1; i < 2; i++ ) {
                 for ( int j = -1; j < 2; j++ ) {
-                    if ( ( i == 0 || j == 0 ) && !( i == 0 && j == 0 ) ) {
+                    if ( ( i == 0 || j == 0 || corners ) && !( i == 0 && j == 0 ) ) {
                         neighbors.push_back( { i, j, 0 } );
                     }
                 }
@@ -285,11 +455,28 @@ namespace ExaCLAMR {
 
             halo_pattern.setNeighbors( neighbors );
 
-            // Initialize Halo Array Layours
-            _cell_state_halo = Cajita::createHalo( halo_pattern, cl.halo_size, *_momentum_a, *_height_a, *_momentum_b, *_height_b );
-
-            // Initialize State Values ( Height, Momentum )
-            initialize( create_functor );
+            // Initialize Halo Array Layours - Both Time Levels Share the Layouts of the A State Arrays
+            // No Cajita Halo is Created for the Interleaved Ordering, which Only Gathers Through the Packed Halo
+            _cell_state_halo = cell_storage::halo( halo_pattern, cl.halo_size, *_momentum_a, *_height_a );
+
+            // Halo Transport Moving the Packed Buffers
+            int transport = HaloTransportType::NONBLOCKING;
+            if ( !cl.transport.compare( "persistent" ) )
+                transport = HaloTransportType::PERSISTENT;
+            else if ( !cl.transport.compare( "neighbor" ) )
+                transport = HaloTransportType::NEIGHBOR;
+            else if ( !cl.transport.compare( "rma" ) )
+                transport = HaloTransportType::RMA;
+            else if ( !cl.transport.compare( "shared" ) )
+                transport = HaloTransportType::SHARED;
+
+            // Packed Halo Gathering Momentum and Height in One Message per Neighbor
+            // The Stencil Reads Both Fields Equally Deep, so Both are Exchanged at the Full Halo Depth
+            _cell_state_packed_halo = std::make_shared<packed_halo>( halo_pattern, std::vector<int>{ cl.halo_size, cl.halo_size }, transport, *_momentum_a, *_height_a );
+
+            // Cell Traversal - Every State Array Shares the Layout of the Height Array
+            int traversal = !cl.traversal.compare( "index" ) ? TraversalType::INDEX : TraversalType::STORAGE;
+            _cell_order   = std::make_shared<cell_order>( _height_a->view(), traversal );
         };
 
         /**
@@ -319,8 +506,8 @@ namespace ExaCLAMR {
             auto h_b = get( Location::Cell(), Field::Height(), 1 );
 
             // Loop Over All Ghost Cells ( i, j, k )
-            Kokkos::parallel_for(
-                "Initializing", Cajita::createExecutionPolicy( ghost_cells, ExecutionSpace() ), KOKKOS_LAMBDA( const int i, const int j, const int k ) {
+            cellFor(
+                "Initializing", *_cell_order, ghost_cells, ExecutionSpace(), KOKKOS_LAMBDA( const int i, const int j, const int k ) {
                     // DEBUG: Print Rank and Owned / Ghost Extents
                     // if ( DEBUG ) std::cout << "Rank: " << _mesh->rank() << "\tOwned Extent: " << owned_cells.extent( 0 ) << owned_cells.extent( 1 ) << owned_cells.extent( 2 ) << "\n";
                     // if ( DEBUG ) std::cout << "Rank: " << _mesh->rank() << "\tGhost Extent: " << ghost_cells.extent( 0 ) << ghost_cells.extent( 1 ) << ghost_cells.extent( 2 ) << "\n";
@@ -361,6 +548,14 @@ namespace ExaCLAMR {
             return _mesh;
         };
 
+        /**
+         * Return Cell Order
+         * @return Order kernels walk the cells of the state arrays in
+         **/
+        const cell_order &order() const {
+            return *_cell_order;
+        };
+
         /**
          * Return Momentum Field
          * @param Location::Cell
@@ -390,167 +585,72 @@ namespace ExaCLAMR {
         };
 
         /**
-         * Return HxFluxPlus Field at Cell Centers
-         * @param Location::Cell
-         * @param Field::HxFluxPlus
-         * @return Returns HxFluxPlus state array at cell centers
-         **/
-        typename cell_array::view_type get( Location::Cell, Field::HxFluxPlus ) const {
-            return _hx_flux_plus->view();
-        }
-
-        /**
-         * Return HxFluxMinus Field at Cell Centers
-         * @param Location::Cell
-         * @param Field::HxFluxMinus
-         * @return Returns HxFluxMinus state array at cell centers
-         **/
-        typename cell_array::view_type get( Location::Cell, Field::HxFluxMinus ) const {
-            return _hx_flux_minus->view();
-        }
-
-        /**
-         * Return UxFluxPlus Field at Cell Centers
-         * @param Location::Cell
-         * @param Field::UxFluxPlus
-         * @return Returns UxFluxPlus state array at cell centers
-         **/
-        typename cell_array::view_type get( Location::Cell, Field::UxFluxPlus ) const {
-            return _ux_flux_plus->view();
-        }
-
-        /**
-         * Return UxFluxMinus Field at Cell Centers
-         * @param Location::Cell
-         * @param Field::UxFluxMinus
-         * @return Returns UxFluxMinus state array at cell centers
-         **/
-        typename cell_array::view_type get( Location::Cell, Field::UxFluxMinus ) const {
-            return _ux_flux_minus->view();
-        }
-
-        /**
-         * Return HyFluxPlus Field at Cell Centers
-         * @param Location::Cell
-         * @param Field::HyFluxPlus
-         * @return Returns HyFluxPlus state array at cell centers
-         **/
-        typename cell_array::view_type get( Location::Cell, Field::HyFluxPlus ) const {
-            return _hy_flux_plus->view();
-        }
-
-        /**
-         * Return HyFluxMinus Field at Cell Centers
-         * @param Location::Cell
-         * @param Field::HyFluxMinus
-         * @return Returns HyFluxMinus state array at cell centers
+         * Return X-Face Flux Field
+         * @param Location::Face
+         * @param Field::XFlux
+         * @return Returns flux and flux corrector array at x-faces
          **/
-        typename cell_array::view_type get( Location::Cell, Field::HyFluxMinus ) const {
-            return _hy_flux_minus->view();
-        }
-
-        /**
-         * Return UyFluxPlus Field at Cell Centers
-         * @param Location::Cell
-         * @param Field::UyFluxPlus
-         * @return Returns UyFluxPlus state array at cell centers
-         **/
-        typename cell_array::view_type get( Location::Cell, Field::UyFluxPlus ) const {
-            return _uy_flux_plus->view();
-        }
-
-        /**
-         * Return UyFluxMinus Field at Cell Centers
-         * @param Location::Cell
-         * @param Field::UyFluxMinus
-         * @return Returns UyFluxMinus state array at cell centers
-         **/
-        typename cell_array::view_type get( Location::Cell, Field::UyFluxMinus ) const {
-            return _uy_flux_minus->view();
-        }
-
-        /**
-         * Return HxWPlus Field at Cell Centers
-         * @param Location::Cell
-         * @param Field::HxWPlus
-         * @return Returns HxWPlus state array at cell centers
-         **/
-        typename cell_array::view_type get( Location::Cell, Field::HxWPlus ) const {
-            return _hx_w_plus->view();
-        }
-
-        /**
-         * Return HxWMinus Field at Cell Centers
-         * @param Location::Cell
-         * @param Field::HxWMinus
-         * @return Returns HxWMinus state array at cell centers
-         **/
-        typename cell_array::view_type get( Location::Cell, Field::HxWMinus ) const {
-            return _hx_w_minus->view();
-        }
+        typename x_face_array::view_type get( Location::Face, Field::XFlux ) const {
+            return _x_flux->view();
+        };
 
         /**
-         * Return HyWPlus Field at Cell Centers
-         * @param Location::Cell
-         * @param Field::HyWPlus
-         * @return Returns HyWPlus state array at cell centers
+         * Return Y-Face Flux Field
+         * @param Location::Face
+         * @param Field::YFlux
+         * @return Returns flux and flux corrector array at y-faces
          **/
-        typename cell_array::view_type get( Location::Cell, Field::HyWPlus ) const {
-            return _hy_w_plus->view();
-        }
-
-        /**
-         * Return HyWMinus Field at Cell Centers
-         * @param Location::Cell
-         * @param Field::HyWMinus
-         * @return Returns HyWMinus state array at cell centers
-         **/
-        typename cell_array::view_type get( Location::Cell, Field::HyWMinus ) const {
-            return _hy_w_minus->view();
-        }
+        typename y_face_array::view_type get( Location::Face, Field::YFlux ) const {
+            return _y_flux->view();
+        };
 
         /**
-         * Return UWPlus Field at Cell Centers
+         * Scatter State Data to Neighbors
          * @param Location::Cell
-         * @param Field::UWPlus
-         * @return Returns UWPlus state array at cell centers
+         * @param t Toggle between state arrays
          **/
-        typename cell_array::view_type get( Location::Cell, Field::UWPlus ) const {
-            return _u_w_plus->view();
-        }
+        void scatter( Location::Cell, int t ) const {
+            if ( t == 0 )
+                cell_storage::scatter( ExecutionSpace(), _cell_state_halo, *_momentum_a, *_height_a );
+            else
+                cell_storage::scatter( ExecutionSpace(), _cell_state_halo, *_momentum_b, *_height_b );
+        };
 
         /**
-         * Return UWMinus Field at Cell Centers
+         * Gather State Data from Neighbors
          * @param Location::Cell
-         * @param Field::UWMinus
-         * @return Returns UWMinus state array at cell centers
+         * @param t Toggle between state arrays
          **/
-        typename cell_array::view_type get( Location::Cell, Field::UWMinus ) const {
-            return _u_w_minus->view();
+        void gather( Location::Cell, int t ) const {
+            if ( t == 0 )
+                _cell_state_packed_halo->gather( ExecutionSpace(), *_momentum_a, *_height_a );
+            else
+                _cell_state_packed_halo->gather( ExecutionSpace(), *_momentum_b, *_height_b );
         }
 
         /**
-         * Scatter State Data to Neighbors
+         * Start Gathering State Data from Neighbors
+         * Ghost cells of the state arrays are not valid until the gather is finished
          * @param Location::Cell
          * @param t Toggle between state arrays
          **/
-        void scatter( Location::Cell, int t ) const {
+        void gatherStart( Location::Cell, int t ) const {
             if ( t == 0 )
-                _cell_state_halo->scatter( ExecutionSpace(), *_momentum_a, *_height_a );
+                _cell_state_packed_halo->gatherStart( ExecutionSpace(), *_momentum_a, *_height_a );
             else
-                _cell_state_halo->scatter( ExecutionSpace(), *_momentum_b, *_height_b );
-        };
+                _cell_state_packed_halo->gatherStart( ExecutionSpace(), *_momentum_b, *_height_b );
+        }
 
         /**
-         * Gather State Data from Neighbors
+         * Finish Gathering State Data from Neighbors
          * @param Location::Cell
          * @param t Toggle between state arrays
          **/
-        void gather( Location::Cell, int t ) const {
+        void gatherFinish( Location::Cell, int t ) const {
             if ( t == 0 )
-                _cell_state_halo->gather( ExecutionSpace(), *_momentum_a, *_height_a );
+                _cell_state_packed_halo->gatherFinish( ExecutionSpace(), *_momentum_a, *_height_a );
             else
-                _cell_state_halo->gather( ExecutionSpace(), *_momentum_b, *_height_b );
+                _cell_state_packed_halo->gatherFinish( ExecutionSpace(), *_momentum_b, *_height_b );
         }
 
       private:
@@ -561,25 +661,13 @@ namespace ExaCLAMR {
         std::shared_ptr<cell_array> _momentum_b; /**< Momentum state array 2 */
         std::shared_ptr<cell_array> _height_b;   /**< Height state array 2 */
 
-        std::shared_ptr<cell_array> _hx_flux_plus;  /**< Height x-direction positive flux array */
-        std::shared_ptr<cell_array> _hx_flux_minus; /**< Height x-direction negative flux array */
-        std::shared_ptr<cell_array> _ux_flux_plus;  /**< X-Momentum positive flux array */
-        std::shared_ptr<cell_array> _ux_flux_minus; /**< X-Momentum negative flux array */
-
-        std::shared_ptr<cell_array> _hy_flux_plus;  /**< Height y-direction positive flux array */
-        std::shared_ptr<cell_array> _hy_flux_minus; /**< Height y-direction negative flux array */
-        std::shared_ptr<cell_array> _uy_flux_plus;  /**< Y-Momentum positive flux array */
-        std::shared_ptr<cell_array> _uy_flux_minus; /**< Y-Momentum negative flux array */
-
-        std::shared_ptr<cell_array> _hx_w_plus;  /**< Height x-direction positive flux corrector array */
-        std::shared_ptr<cell_array> _hx_w_minus; /**< Height x-direction negative flux corrector array */
-        std::shared_ptr<cell_array> _hy_w_plus;  /**< Height y-direction positive flux corrector array */
-        std::shared_ptr<cell_array> _hy_w_minus; /**< Height y-direction negative flux corrector array */
+        std::shared_ptr<x_face_array> _x_flux; /**< X-face flux array ( face kernel only ) */
+        std::shared_ptr<y_face_array> _y_flux; /**< Y-face flux array ( face kernel only ) */
 
-        std::shared_ptr<cell_array> _u_w_plus;  /**< Momentum positive flux corrector array */
-        std::shared_ptr<cell_array> _u_w_minus; /**< Momentum negative flux corrector array */
+        std::shared_ptr<halo>        _cell_state_halo;        /**< Cajita halo for scattering the state arrays ( none for the interleaved ordering ) */
+        std::shared_ptr<packed_halo> _cell_state_packed_halo; /**< Halo gathering the state arrays in one message per neighbor */
 
-        std::shared_ptr<halo> _cell_state_halo; /**< Halo for A state arrays */
+        std::shared_ptr<cell_order> _cell_order; /**< Order kernels walk the cells in */
     };
 
 } // namespace ExaCLAMR
@@ -0,0 +1,235 @@
+/**
+ * @file
+ * @author Patrick Bridges <pbridges@unm.edu>
+ * @author Jered Dominguez-Trujillo <jereddt@unm.edu>
+ *
+ * @section DESCRIPTION
+ * Measured-cost load balancing of the regular mesh
+ * Moves the block edges along each dimension so that every row and column of blocks carries an equal share of the measured cost
+ * Migrates the state to the new blocks
+ */
+
+#ifndef EXACLAMR_REBALANCE_HPP
+#define EXACLAMR_REBALANCE_HPP
+
+#ifndef DEBUG
+#define DEBUG 0
+#endif
+
+// Include Statements
+#include <ExaCLAMR.hpp>
+#include <Mesh.hpp>
+#include <ProblemManager.hpp>
+#include <StateMirror.hpp>
+
+#include <Cajita.hpp>
+#include <Kokkos_Core.hpp>
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+namespace ExaCLAMR {
+
+    /**
+ * Smallest cost imbalance ( most expensive rank over the mean ) worth migrating the state for
+ */
+    static const double rebalance_tolerance = 1.05;
+
+    /**
+ * Reduces the Cost Imbalance of the Ranks
+ * @param cost Cost of this rank
+ * @param comm MPI communicator
+ * @return Most expensive rank's cost over the mean cost - 1 if no cost was measured
+ */
+    inline double costImbalance( const double cost, MPI_Comm comm ) {
+        int    comm_size;
+        double max_cost, total_cost;
+        MPI_Comm_size( comm, &comm_size );
+        MPI_Allreduce( &cost, &max_cost, 1, MPI_DOUBLE, MPI_MAX, comm );
+        MPI_Allreduce( &cost, &total_cost, 1, MPI_DOUBLE, MPI_SUM, comm );
+
+        return ( total_cost > 0.0 ) ? max_cost * comm_size / total_cost : 1.0;
+    }
+
+    /**
+ * Computes Block Edges that Balance the Measured Cost
+ * The cost of each rank is spread evenly over the slices of its block along each dimension and summed across ranks
+ * Each dimension's edges then split the summed cost of the slices into equal shares
+ * Every block keeps at least a halo of cells beside the physical padding, so neighbors can still fill their halos from it
+ *
+ * @param mesh Mesh split at the current edges
+ * @param cost Cost of this rank over the last measurement
+ * @param halo_size Number of halo cells
+ * @param periodic Periodicity of domain
+ * @return Block edges along each dimension
+ */
+    template <class state_t, class MemorySpace>
+    std::array<std::vector<int>, 3> balancedEdges( const Mesh<ExaCLAMR::RegularMesh<state_t>, MemorySpace> &mesh, const double cost, const int halo_size, const std::array<bool, 3> &periodic ) {
+        auto &global_grid = mesh.localGrid()->globalGrid();
+
+        std::array<std::vector<int>, 3> edges;
+        for ( int dim = 0; dim < 3; dim++ ) {
+            edges[dim]  = mesh.blockEdges( dim );
+            int blocks  = edges[dim].size() - 1;
+            int block   = global_grid.dimBlockId( dim );
+            int cells   = edges[dim].back();
+            int padding = ( !periodic[dim] && cells > 1 ) ? halo_size : 0;
+            if ( blocks == 1 ) continue;
+
+            // Cost of Each Slice of Cells Across the Dimension
+            std::vector<double> slice_cost( cells, 0.0 ), total_cost( cells );
+            for ( int c = edges[dim][block]; c < edges[dim][block + 1]; c++ ) slice_cost[c] = cost / ( edges[dim][block + 1] - edges[dim][block] );
+            MPI_Allreduce( slice_cost.data(), total_cost.data(), cells, MPI_DOUBLE, MPI_SUM, global_grid.comm() );
+
+            std::vector<double> prefix( cells + 1, 0.0 );
+            for ( int c = 0; c < cells; c++ ) prefix[c + 1] = prefix[c] + total_cost[c];
+
+            // Fewest Cells a Block may Own
+            std::vector<int> min_cells( blocks, halo_size );
+            min_cells.front() += padding;
+            min_cells.back() += padding;
+
+            // Place Each Edge at the Slice Closest to its Share of the Cost, Leaving Room for the Blocks on Either Side
+            int remaining = 0;
+            for ( int b = 0; b < blocks; b++ ) remaining += min_cells[b];
+
+            for ( int b = 1; b < blocks; b++ ) {
+                remaining -= min_cells[b - 1];
+                double share = prefix[cells] * b / blocks;
+                int    edge  = std::lower_bound( prefix.begin(), prefix.end(), share ) - prefix.begin();
+                if ( edge > 0 && share - prefix[edge - 1] < prefix[edge] - share ) edge--;
+
+                edges[dim][b] = std::min( std::max( edge, edges[dim][b - 1] + min_cells[b - 1] ), cells - remaining );
+            }
+        }
+
+        return edges;
+    }
+
+    /**
+ * Migrates a Time Level of the State Between Decompositions
+ * Every rank sends the cells of its old block that lie in each rank's new block in a single all-to-all
+ * Ghost cells of the target are left to the next halo exchange
+ *
+ * @param source Problem manager of the old decomposition
+ * @param target Problem manager of the new decomposition - built over the same ranks as the source
+ * @param level Time level to migrate ( 0 or 1 )
+ */
+    template <class ProblemManagerType>
+    void migrateState( const ProblemManagerType &source, const ProblemManagerType &target, const int level ) {
+        auto     source_mesh = source.mesh();
+        auto     target_mesh = target.mesh();
+        MPI_Comm comm        = source_mesh->localGrid()->globalGrid().comm();
+
+        int comm_size, rank;
+        MPI_Comm_size( comm, &comm_size );
+        MPI_Comm_rank( comm, &rank );
+
+        // Block of Every Rank in Both Decompositions - the Grids may Number their Ranks Differently
+        std::vector<int> local_blocks( 6 ), blocks( 6 * comm_size );
+        for ( int dim = 0; dim < 3; dim++ ) {
+            local_blocks[dim]     = source_mesh->localGrid()->globalGrid().dimBlockId( dim );
+            local_blocks[3 + dim] = target_mesh->localGrid()->globalGrid().dimBlockId( dim );
+        }
+        MPI_Allgather( local_blocks.data(), 6, MPI_INT, blocks.data(), 6, MPI_INT, comm );
+
+        // Global Cells of the Block of a Rank
+        auto block = [&]( const decltype( source_mesh ) &mesh, const int r ) {
+            int first = 6 * r + ( mesh == source_mesh ? 0 : 3 );
+
+            std::array<long, 3> min, max;
+            for ( int dim = 0; dim < 3; dim++ ) {
+                min[dim] = mesh->blockEdges( dim )[blocks[first + dim]];
+                max[dim] = mesh->blockEdges( dim )[blocks[first + dim] + 1];
+            }
+            return Cajita::IndexSpace<3>( min, max );
+        };
+
+        auto overlap = []( const Cajita::IndexSpace<3> &a, const Cajita::IndexSpace<3> &b ) {
+            std::array<long, 3> min, max;
+            for ( int dim = 0; dim < 3; dim++ ) {
+                min[dim] = std::max( a.min( dim ), b.min( dim ) );
+                max[dim] = std::max( min[dim], std::min( a.max( dim ), b.max( dim ) ) );
+            }
+            return Cajita::IndexSpace<3>( min, max );
+        };
+
+        auto h_source = source.get( Location::Cell(), Field::Height(), level );
+        auto u_source = source.get( Location::Cell(), Field::Momentum(), level );
+        auto h_target = target.get( Location::Cell(), Field::Height(), level );
+        auto u_target = target.get( Location::Cell(), Field::Momentum(), level );
+
+        using storage_t = typename decltype( h_source )::non_const_value_type;
+
+        auto h_source_host = stateToHost( h_source );
+        auto u_source_host = stateToHost( u_source );
+        auto h_target_host = stateToHost( h_target );
+        auto u_target_host = stateToHost( u_target );
+
+        // Local Index of the First Owned Cell
+        auto source_owned = source_mesh->localGrid()->indexSpace( Cajita::Own(), Cajita::Cell(), Cajita::Local() );
+        auto target_owned = target_mesh->localGrid()->indexSpace( Cajita::Own(), Cajita::Cell(), Cajita::Local() );
+
+        auto source_block = block( source_mesh, rank );
+        auto target_block = block( target_mesh, rank );
+
+        // Height and Momentum of Every Cell Moved, Ordered by Rank
+        std::vector<storage_t> send, recv;
+        std::vector<int>       send_counts( comm_size ), send_displs( comm_size ), recv_counts( comm_size ), recv_displs( comm_size );
+
+        for ( int r = 0; r < comm_size; r++ ) {
+            auto cells = overlap( source_block, block( target_mesh, r ) );
+
+            send_displs[r] = send.size() * sizeof( storage_t );
+            for ( long i = cells.min( 0 ); i < cells.max( 0 ); i++ ) {
+                for ( long j = cells.min( 1 ); j < cells.max( 1 ); j++ ) {
+                    for ( long k = cells.min( 2 ); k < cells.max( 2 ); k++ ) {
+                        long li = i - source_block.min( 0 ) + source_owned.min( 0 );
+                        long lj = j - source_block.min( 1 ) + source_owned.min( 1 );
+                        long lk = k - source_block.min( 2 ) + source_owned.min( 2 );
+
+                        send.push_back( h_source_host( li, lj, lk, 0 ) );
+                        send.push_back( u_source_host( li, lj, lk, 0 ) );
+                        send.push_back( u_source_host( li, lj, lk, 1 ) );
+                    }
+                }
+            }
+            send_counts[r] = send.size() * sizeof( storage_t ) - send_displs[r];
+
+            recv_displs[r] = ( r > 0 ) ? recv_displs[r - 1] + recv_counts[r - 1] : 0;
+            recv_counts[r] = overlap( block( source_mesh, r ), target_block ).size() * 3 * sizeof( storage_t );
+        }
+
+        recv.resize( ( recv_displs.back() + recv_counts.back() ) / sizeof( storage_t ) );
+        MPI_Alltoallv( send.data(), send_counts.data(), send_displs.data(), MPI_BYTE, recv.data(), recv_counts.data(), recv_displs.data(), MPI_BYTE, comm );
+
+        // Unpack in the Order the Cells were Packed
+        long n = 0;
+        for ( int r = 0; r < comm_size; r++ ) {
+            auto cells = overlap( block( source_mesh, r ), target_block );
+
+            for ( long i = cells.min( 0 ); i < cells.max( 0 ); i++ ) {
+                for ( long j = cells.min( 1 ); j < cells.max( 1 ); j++ ) {
+                    for ( long k = cells.min( 2 ); k < cells.max( 2 ); k++ ) {
+                        long li = i - target_block.min( 0 ) + target_owned.min( 0 );
+                        long lj = j - target_block.min( 1 ) + target_owned.min( 1 );
+                        long lk = k - target_block.min( 2 ) + target_owned.min( 2 );
+
+                        h_target_host( li, lj, lk, 0 ) = recv[n++];
+                        u_target_host( li, lj, lk, 0 ) = recv[n++];
+                        u_target_host( li, lj, lk, 1 ) = recv[n++];
+                    }
+                }
+            }
+        }
+
+        stateFromHost( h_target, h_target_host );
+        stateFromHost( u_target, u_target_host );
+    }
+
+} // namespace ExaCLAMR
+
+#endif
@@ -16,6 +16,7 @@
 
 // Include Statements
 #include <ExaCLAMR.hpp>
+#include <StateMirror.hpp>
 
 #include <Cajita.hpp>
 
@@ -78,8 +79,8 @@ namespace ExaCLAMR {
         std::shared_ptr<ProblemManager<ExaCLAMR::AMRMesh<state_t>, MemorySpace, ExecutionSpace, OrderingView>> _pm; /**< Problem Manager Shared Pointer */
     };
 
-    template <class state_t, class MemorySpace, class ExecutionSpace, class OrderingView>
-    class SiloWriter<ExaCLAMR::RegularMesh<state_t>, MemorySpace, ExecutionSpace, OrderingView> {
+    template <class state_t, class storage_t, class MemorySpace, class ExecutionSpace, class OrderingView>
+    class SiloWriter<ExaCLAMR::RegularMesh<state_t, storage_t>, MemorySpace, ExecutionSpace, OrderingView> {
       public:
         /**
          * Constructor
@@ -104,7 +105,8 @@ namespace ExaCLAMR {
         void writeFile( DBfile *dbfile, char *name, int time_step, state_t time, state_t dt ) {
             // Initialize Variables
             int        dims[2], zdims[2], nx, ny, ndims;
-            state_t *  coords[2], *vars[2], dx, dy;
+            state_t *  coords[2], dx, dy;
+            storage_t *vars[2];
             char *     coordnames[2], *varnames[2];
             DBoptlist *optlist;
 
@@ -123,8 +125,11 @@ namespace ExaCLAMR {
             // Set DB Options: Time Step, Time Stamp and Delta Time
             optlist = DBMakeOptlist( 10 );
             DBAddOption( optlist, DBOPT_CYCLE, &time_step );
-            DBAddOption( optlist, DBOPT_TIME, &time );
-            DBAddOption( optlist, DBOPT_DTIME, &dt );
+            // Silo Reads DBOPT_TIME as a Float and DBOPT_DTIME as a Double Regardless of the State Precision
+            float  silo_time = time;
+            double silo_dt   = dt;
+            DBAddOption( optlist, DBOPT_TIME, &silo_time );
+            DBAddOption( optlist, DBOPT_DTIME, &silo_dt );
 
             // Get Domain Space
             auto domain = _pm->mesh()->domainSpace();
@@ -149,9 +154,9 @@ namespace ExaCLAMR {
             coordnames[0] = strdup( "x" );
             coordnames[1] = strdup( "y" );
 
-            // Initialize Coordinate and State Arrays for Writing
-            state_t x[dims[0]], y[dims[1]];
-            state_t height[nx * ny], u[nx * ny], v[nx * ny];
+            // Initialize Coordinate and State Arrays for Writing - State is Written in its Storage Precision
+            state_t   x[dims[0]], y[dims[1]];
+            storage_t height[nx * ny], u[nx * ny], v[nx * ny];
 
             // Point Coords to X and Y Coordinates
             coords[0] = x;
@@ -181,11 +186,8 @@ namespace ExaCLAMR {
             auto uNew = _pm->get( Location::Cell(), Field::Momentum(), NEWFIELD( time_step ) );
             auto hNew = _pm->get( Location::Cell(), Field::Height(), NEWFIELD( time_step ) );
 
-            auto uHost = Kokkos::create_mirror_view( uNew );
-            auto hHost = Kokkos::create_mirror_view( hNew );
-
-            Kokkos::deep_copy( uHost, uNew );
-            Kokkos::deep_copy( hHost, hNew );
+            auto uHost = stateToHost( uNew );
+            auto hHost = stateToHost( hNew );
 
             // Loop Over Domain ( i, j, k )
             for ( int i = domain.min( 0 ); i < domain.max( 0 ); i++ ) {
@@ -209,15 +211,15 @@ namespace ExaCLAMR {
             // Write Scalar Variables
             // Height
             DBPutQuadvar1( dbfile, "height", name, height, zdims, ndims,
-                           NULL, 0, SiloTraits<state_t>::type(), DB_ZONECENT, optlist );
+                           NULL, 0, SiloTraits<storage_t>::type(), DB_ZONECENT, optlist );
 
             // Vx
             DBPutQuadvar1( dbfile, "ucomp", name, u, zdims, ndims,
-                           NULL, 0, SiloTraits<state_t>::type(), DB_ZONECENT, optlist );
+                           NULL, 0, SiloTraits<storage_t>::type(), DB_ZONECENT, optlist );
 
             // Vy
             DBPutQuadvar1( dbfile, "vcomp", name, v, zdims, ndims,
-                           NULL, 0, SiloTraits<state_t>::type(), DB_ZONECENT, optlist );
+                           NULL, 0, SiloTraits<storage_t>::type(), DB_ZONECENT, optlist );
 
             // Setup and Write Momentum Variable
             vars[0]     = u;
@@ -227,7 +229,7 @@ namespace ExaCLAMR {
 
             // Momentum
             DBPutQuadvar( dbfile, "momentum", name, 2, (DBCAS_t)varnames,
-                          vars, zdims, ndims, NULL, 0, SiloTraits<state_t>::type(), DB_ZONECENT, optlist );
+                          vars, zdims, ndims, NULL, 0, SiloTraits<storage_t>::type(), DB_ZONECENT, optlist );
 
             // Free Option List
             DBFreeOptlist( optlist );
@@ -395,7 +397,7 @@ namespace ExaCLAMR {
         }
 
       private:
-        std::shared_ptr<ProblemManager<ExaCLAMR::RegularMesh<state_t>, MemorySpace, ExecutionSpace, OrderingView>> _pm; /**< Problem Manager Shared Pointer */
+        std::shared_ptr<ProblemManager<ExaCLAMR::RegularMesh<state_t, storage_t>, MemorySpace, ExecutionSpace, OrderingView>> _pm; /**< Problem Manager Shared Pointer */
     };
 
 }; // namespace ExaCLAMR
@@ -0,0 +1,190 @@
+/**
+ * @file
+ * @author Patrick Bridges <pbridges@unm.edu>
+ * @author Jered Dominguez-Trujillo <jereddt@unm.edu>
+ *
+ * @section DESCRIPTION
+ * Portable fixed-width SIMD vector type for host kernels
+ * Lane-wise arithmetic, fabs, sqrt, fmin and fmax written as fixed-length loops the compiler maps onto vector registers
+ * Contiguous and strided loads and stores of whole vectors for unit-stride rows
+ */
+
+#ifndef EXACLAMR_SIMD_HPP
+#define EXACLAMR_SIMD_HPP
+
+#ifndef DEBUG
+#define DEBUG 0
+#endif
+
+// Include Statements
+#include <Kokkos_Core.hpp>
+
+#include <cmath>
+
+// Width of the Widest Vector Registers Available in Bytes
+#ifndef EXACLAMR_SIMD_BYTES
+#if defined( __AVX512F__ )
+#define EXACLAMR_SIMD_BYTES 64
+#elif defined( __AVX__ )
+#define EXACLAMR_SIMD_BYTES 32
+#else
+#define EXACLAMR_SIMD_BYTES 16
+#endif
+#endif
+
+namespace ExaCLAMR {
+
+    /**
+ * @struct SimdWidth
+ * @brief Number of lanes of a scalar type that fit in a vector register
+ */
+    template <typename state_t>
+    struct SimdWidth {
+        static constexpr int value = ( EXACLAMR_SIMD_BYTES / sizeof( state_t ) > 0 ) ? EXACLAMR_SIMD_BYTES / sizeof( state_t ) : 1;
+    };
+
+    /**
+ * @struct Simd
+ * @brief Fixed-width vector of scalars with lane-wise arithmetic
+ * Scalars convert implicitly to a vector with every lane set, so scalar code templated on its value type runs unchanged
+ */
+    template <typename state_t, int W = SimdWidth<state_t>::value>
+    struct Simd {
+        state_t v[W]; /**< Lanes */
+
+        KOKKOS_INLINE_FUNCTION
+        Simd() {}
+
+        /**
+         * Broadcast Constructor
+         * @param s Value of every lane
+         **/
+        KOKKOS_INLINE_FUNCTION
+        Simd( const state_t s ) {
+            for ( int l = 0; l < W; l++ ) v[l] = s;
+        }
+
+        /**
+         * Number of lanes
+         **/
+        KOKKOS_INLINE_FUNCTION
+        static constexpr int size() { return W; }
+
+        /**
+         * Load the Lanes from Consecutive Elements
+         * @param p First element
+         **/
+        template <typename T>
+        KOKKOS_INLINE_FUNCTION void copy_from( const T *p ) {
+            for ( int l = 0; l < W; l++ ) v[l] = p[l];
+        }
+
+        /**
+         * Load the Lanes from Elements a Fixed Stride Apart
+         * @param p First element
+         * @param stride Elements between consecutive lanes
+         **/
+        template <typename T>
+        KOKKOS_INLINE_FUNCTION void copy_from( const T *p, const long stride ) {
+            for ( int l = 0; l < W; l++ ) v[l] = p[l * stride];
+        }
+
+        /**
+         * Store the Lanes to Consecutive Elements
+         * @param p First element
+         **/
+        template <typename T>
+        KOKKOS_INLINE_FUNCTION void copy_to( T *p ) const {
+            for ( int l = 0; l < W; l++ ) p[l] = v[l];
+        }
+
+        /**
+         * Store the Lanes to Elements a Fixed Stride Apart
+         * @param p First element
+         * @param stride Elements between consecutive lanes
+         **/
+        template <typename T>
+        KOKKOS_INLINE_FUNCTION void copy_to( T *p, const long stride ) const {
+            for ( int l = 0; l < W; l++ ) p[l * stride] = v[l];
+        }
+
+        KOKKOS_INLINE_FUNCTION
+        state_t &operator[]( const int l ) { return v[l]; }
+
+        KOKKOS_INLINE_FUNCTION
+        const state_t &operator[]( const int l ) const { return v[l]; }
+
+        KOKKOS_INLINE_FUNCTION
+        friend Simd operator+( const Simd &a, const Simd &b ) {
+            Simd r;
+            for ( int l = 0; l < W; l++ ) r.v[l] = a.v[l] + b.v[l];
+            return r;
+        }
+
+        KOKKOS_INLINE_FUNCTION
+        friend Simd operator-( const Simd &a, const Simd &b ) {
+            Simd r;
+            for ( int l = 0; l < W; l++ ) r.v[l] = a.v[l] - b.v[l];
+            return r;
+        }
+
+        KOKKOS_INLINE_FUNCTION
+        friend Simd operator*( const Simd &a, const Simd &b ) {
+            Simd r;
+            for ( int l = 0; l < W; l++ ) r.v[l] = a.v[l] * b.v[l];
+            return r;
+        }
+
+        KOKKOS_INLINE_FUNCTION
+        friend Simd operator/( const Simd &a, const Simd &b ) {
+            Simd r;
+            for ( int l = 0; l < W; l++ ) r.v[l] = a.v[l] / b.v[l];
+            return r;
+        }
+
+        KOKKOS_INLINE_FUNCTION
+        friend Simd operator-( const Simd &a ) {
+            Simd r;
+            for ( int l = 0; l < W; l++ ) r.v[l] = -a.v[l];
+            return r;
+        }
+
+        KOKKOS_INLINE_FUNCTION
+        Simd &operator*=( const Simd &b ) {
+            for ( int l = 0; l < W; l++ ) v[l] *= b.v[l];
+            return *this;
+        }
+
+        KOKKOS_INLINE_FUNCTION
+        friend Simd fabs( const Simd &a ) {
+            Simd r;
+            for ( int l = 0; l < W; l++ ) r.v[l] = std::fabs( a.v[l] );
+            return r;
+        }
+
+        KOKKOS_INLINE_FUNCTION
+        friend Simd sqrt( const Simd &a ) {
+            Simd r;
+            for ( int l = 0; l < W; l++ ) r.v[l] = std::sqrt( a.v[l] );
+            return r;
+        }
+
+        // Limiter Min and Max - Select Form so the Loops Compile to Vector Min and Max Instructions
+        KOKKOS_INLINE_FUNCTION
+        friend Simd fmin( const Simd &a, const Simd &b ) {
+            Simd r;
+            for ( int l = 0; l < W; l++ ) r.v[l] = ( b.v[l] < a.v[l] ) ? b.v[l] : a.v[l];
+            return r;
+        }
+
+        KOKKOS_INLINE_FUNCTION
+        friend Simd fmax( const Simd &a, const Simd &b ) {
+            Simd r;
+            for ( int l = 0; l < W; l++ ) r.v[l] = ( b.v[l] > a.v[l] ) ? b.v[l] : a.v[l];
+            return r;
+        }
+    };
+
+} // namespace ExaCLAMR
+
+#endif
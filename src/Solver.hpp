@@ -18,9 +18,16 @@
 
 // Include Statements
 #include <BoundaryConditions.hpp>
+#include <CellState.hpp>
+#include <Diagnostics.hpp>
 #include <ExaCLAMR.hpp>
+#include <LayoutHilbert2D.hpp>
+#include <LayoutMorton2D.hpp>
+#include <LayoutTiled2D.hpp>
 #include <Mesh.hpp>
 #include <ProblemManager.hpp>
+#include <Rebalance.hpp>
+#include <StateMirror.hpp>
 #include <TimeIntegration.hpp>
 #include <Timer.hpp>
 
@@ -34,6 +41,7 @@
 #include <mpi.h>
 
 #include <memory>
+#include <stdexcept>
 
 // Seconds to Microseconds
 #define MICROSECONDS 1.0e-6
@@ -67,56 +75,145 @@ namespace ExaCLAMR {
  * @brief Solver class to store problem manager and silo writer and to iterate over specified time steps and write results to file
  **/
 
-    template <class MeshType, class MemorySpace, class ExecutionSpace, class OrderingView>
+    template <class MeshType, class MemorySpace, class ExecutionSpace, class OrderingView, class BoundaryPolicyType = ExaCLAMR::BoundaryCondition>
     class Solver : public SolverBase<MeshType> {};
 
     template <typename state_t, class MemorySpace, class ExecutionSpace, class OrderingView>
     class Solver<ExaCLAMR::AMRMesh<state_t>, MemorySpace, ExecutionSpace, OrderingView> : public SolverBase<ExaCLAMR::AMRMesh<state_t>> {
       public:
+        /**
+         * Constructor
+         * Determine rank
+         * Create new problem manager object, refined to the initial state
+         * Build the face lists and calculate initial diagnostics of the system
+         * Set private variables, time steps, gravity, and sigma
+         * 
+         * @param cl Command line arguments
+         * @param bc Boundary condition - must be reflective on every boundary of the AMR mesh
+         * @param comm MPI communicator
+         * @param create_functor Initialization function
+         * @param partitioner Cajita MPI Partitioner
+         * @param timer ExaCLAMR timer to profile performance
+         */
         template <class InitFunc>
         Solver( const ExaCLAMR::ClArgs<state_t> &  cl,
                 const ExaCLAMR::BoundaryCondition &bc,
                 MPI_Comm                           comm,
                 const InitFunc &                   create_functor,
                 const Cajita::Partitioner &        partitioner,
-                ExaCLAMR::Timer &                  timer ) {
+                ExaCLAMR::Timer &                  timer )
+            : _time_steps( cl.time_steps )
+            , _gravity( cl.gravity )
+            , _sigma( cl.sigma ) {
 
             MPI_Comm_rank( comm, &_rank );
             // DEBUG: Trace Created Solver
             if ( _rank == 0 && DEBUG ) std::cout << "Created AMR Solver\n";
 
+            // The AMR Time Step Mirrors Every Boundary Cell - Other Boundary Types are Not Implemented
+            if ( !bc.uniform( BoundaryType::REFLECTIVE ) ) throw std::logic_error( "AMR mesh supports only reflective boundaries" );
+
             _pm = std::make_shared<ProblemManager<ExaCLAMR::AMRMesh<state_t>, MemorySpace, ExecutionSpace, OrderingView>>( cl, partitioner, comm, create_functor );
 
-// Create Silo Writer
-#ifdef HAVE_SILO
-            _silo = std::make_shared<SiloWriter<ExaCLAMR::AMRMesh<state_t>, MemorySpace, ExecutionSpace, OrderingView>>( _pm );
-#endif
+            // Rank 0 Prints the Cell Count Against a Uniform Mesh at the Finest Level
+            if ( _rank == 0 ) {
+                long uniform = ( (long)cl.global_num_cells[0] * cl.global_num_cells[1] ) << ( 2 * cl.amr_levels );
+                std::cout << std::left << std::setw( 20 ) << "AMR Cells"
+                          << ": " << _pm->mesh()->size() << " of " << uniform << " at the Finest Level\n";
+            }
+
+            _diagnostics = std::make_shared<Diagnostics<state_t>>( cl, comm );
+
+            // Face Lists of the Initial Mesh
+            _faces = TimeIntegrator::amrFaces<MemorySpace>( *_pm, ExecutionSpace() );
 
             MPI_Barrier( MPI_COMM_WORLD );
+
+            // Initial Diagnostics of the System
+            _initial_diagnostics = _diagnostics->allreduce( TimeIntegrator::reduceAMRDiagnostics( *_pm, ExecutionSpace(), _gravity, _sigma, Diagnostics<state_t>::all(), 0 ) );
         };
 
+        /**
+         * Solves PDEs on an AMR mesh
+         * Every time step updates the cells across the face lists, then refines and coarsens the mesh on the new state and rebuilds the face lists
+         * @param write_freq Frequency of writing output and results
+         * @param timer Timer used to profile performance
+         **/
         void solve( const int write_freq, ExaCLAMR::Timer &timer ) override {
             // DEBUG: Trace Solving
-            if ( _rank == 0 && DEBUG ) std::cout << "Regular Solve\n";
+            if ( _rank == 0 && DEBUG ) std::cout << "AMR Solve\n";
+
+            int     time_step    = 0;
+            int     nt           = _time_steps;
+            state_t current_time = 0.0;
+
+            // Rank 0 Prints Initial Iteration and Time
+            if ( _rank == 0 ) {
+                std::cout << std::left << std::setw( 12 ) << "Iteration: " << std::left << std::setw( 12 ) << 0 << std::left << std::setw( 15 ) << "Current Time: " << std::left << std::setw( 12 ) << current_time << std::left << std::setw( 15 ) << "Total Mass: " << std::left << std::setw( 12 ) << _initial_diagnostics.mass << "\n";
+            }
+
+            // Loop Over Time
+            for ( time_step = 1; time_step <= nt; time_step++ ) {
+                timer.computeStart();
+
+                // Time Step of the Current State, Limited by the Finest Cells
+                state_t dt = TimeIntegrator::setAMRTimeStep( *_pm, ExecutionSpace(), _gravity, _sigma, time_step );
+
+                // Update the Cells Across the Face Lists
+                TimeIntegrator::amrStep( *_pm, ExecutionSpace(), _faces, dt, _gravity, time_step );
+
+                // Refine and Coarsen on the New State and List the Faces of the Adapted Mesh
+                _pm->adapt( TimeIntegrator::amrFlags<MemorySpace>( *_pm, ExecutionSpace(), time_step + 1 ), CURRENTFIELD( time_step + 1 ) );
+                _faces = TimeIntegrator::amrFaces<MemorySpace>( *_pm, ExecutionSpace() );
+
+                // Diagnostics of the New State, Only When One is Due
+                int                       due = _diagnostics->due( time_step );
+                DiagnosticValues<state_t> local_diagnostics;
+                if ( due ) local_diagnostics = TimeIntegrator::reduceAMRDiagnostics( *_pm, ExecutionSpace(), _gravity, _sigma, due, time_step + 1 );
+                timer.computeStop();
+
+                timer.communicationStart();
+                DiagnosticValues<state_t> global_diagnostics = local_diagnostics;
+                if ( due ) global_diagnostics = _diagnostics->allreduce( local_diagnostics );
+                timer.communicationStop();
+
+                // Increment Current Time
+                current_time += dt;
+
+                // Output every Write Frequency Time Steps
+                timer.writeStart();
+                if ( 0 == _rank && ( due || 0 == time_step % write_freq ) ) {
+                    std::cout << std::left << std::setw( 12 ) << "Iteration: " << std::left << std::setw( 12 ) << time_step << std::left << std::setw( 15 ) << "Current Time: " << std::left << std::setw( 12 ) << current_time;
+                    _diagnostics->print( due, global_diagnostics, _initial_diagnostics );
+                    std::cout << std::left << std::setw( 15 ) << "Cells: " << _pm->mesh()->size() << "\n";
+                }
+                timer.writeStop();
+            }
         }
 
       private:
-        int                                                                                                    _rank; /**< Rank of solver */
-        std::shared_ptr<ProblemManager<ExaCLAMR::AMRMesh<state_t>, MemorySpace, ExecutionSpace, OrderingView>> _pm;   /**< Problem Manager object */
-#ifdef HAVE_SILO
-        std::shared_ptr<SiloWriter<ExaCLAMR::AMRMesh<state_t>, MemorySpace, ExecutionSpace, OrderingView>> _silo; /**< Silo writer object */
-#endif
+        int     _rank;       /**< Rank of solver */
+        int     _time_steps; /**< Number of time steps to solve for */
+        state_t _gravity;    /**< Gravitational constant */
+        state_t _sigma;      /**< Factor to control CFL number, stability and size of time step */
+
+        TimeIntegrator::AMRFaces<MemorySpace> _faces; /**< X-face and y-face lists of the current mesh */
+
+        std::shared_ptr<Diagnostics<state_t>> _diagnostics;         /**< Diagnostics reduced across ranks and printed */
+        DiagnosticValues<state_t>             _initial_diagnostics; /**< Diagnostics of the initial state */
+
+        std::shared_ptr<ProblemManager<ExaCLAMR::AMRMesh<state_t>, MemorySpace, ExecutionSpace, OrderingView>> _pm; /**< Problem Manager object */
     };
 
-    template <typename state_t, class MemorySpace, class ExecutionSpace, class OrderingView>
-    class Solver<ExaCLAMR::RegularMesh<state_t>, MemorySpace, ExecutionSpace, OrderingView> : public SolverBase<ExaCLAMR::RegularMesh<state_t>> {
+    template <typename state_t, typename storage_t, class MemorySpace, class ExecutionSpace, class OrderingView, class BoundaryPolicyType>
+    class Solver<ExaCLAMR::RegularMesh<state_t, storage_t>, MemorySpace, ExecutionSpace, OrderingView, BoundaryPolicyType> : public SolverBase<ExaCLAMR::RegularMesh<state_t>> {
       public:
         /**
          * Constructor
          * Determine rank
          * Create new problem manager object
          * Create new silo object if silo is available
-         * Calculate initial mass of the system
+         * Calculate initial diagnostics of the system
          * Set private variables, halo size, time steps, gravity, and sigma
          * 
          * @param cl Command line arguments
@@ -134,56 +231,56 @@ namespace ExaCLAMR {
             const InitFunc &                   create_functor,
             const Cajita::Partitioner &        partitioner,
             ExaCLAMR::Timer &                  timer )
-            : _bc( bc )
+            : _cl( cl )
+            , _bc( bc )
+            , _comm( comm )
             , _halo_size( cl.halo_size )
             , _time_steps( cl.time_steps )
+            , _exchange_interval( cl.exchange_interval )
+            , _rebalance_interval( cl.rebalance_interval )
             , _gravity( cl.gravity )
-            , _sigma( cl.sigma ) {
+            , _sigma( cl.sigma )
+            , _safety( cl.safety )
+            , _tile( cl.tile ) {
 
             MPI_Comm_rank( comm, &_rank );
             // DEBUG: Trace Created Solver
             if ( _rank == 0 && DEBUG ) std::cout << "Created Regular Solver\n";
 
-            _pm = std::make_shared<ProblemManager<ExaCLAMR::RegularMesh<state_t>, MemorySpace, ExecutionSpace, OrderingView>>( cl, partitioner, comm, create_functor );
-
-// Create Silo Writer
-#ifdef HAVE_SILO
-            _silo = std::make_shared<SiloWriter<ExaCLAMR::RegularMesh<state_t>, MemorySpace, ExecutionSpace, OrderingView>>( _pm );
-#endif
-
-            MPI_Barrier( MPI_COMM_WORLD );
+            // Select Finite Volume Kernel
+            if ( !cl.kernel.compare( "face" ) )
+                _kernel = TimeIntegrator::KernelType::FACE;
+            else if ( !cl.kernel.compare( "tiled" ) )
+                _kernel = TimeIntegrator::KernelType::TILED;
+            else if ( !cl.kernel.compare( "simd" ) )
+                _kernel = TimeIntegrator::KernelType::SIMD;
+            else
+                _kernel = TimeIntegrator::KernelType::CELL;
 
-            calcMass( 0 );
-        };
+            // Select Time Step Calculation
+            if ( !cl.timestep.compare( "fused" ) )
+                _timestep = TimeIntegrator::TimeStepType::FUSED;
+            else if ( !cl.timestep.compare( "lagged" ) )
+                _timestep = TimeIntegrator::TimeStepType::LAGGED;
+            else
+                _timestep = TimeIntegrator::TimeStepType::SEPARATE;
 
-        /**
-         * Calculates the current mass of the system and stores in either _initial_mass or _current_mass
-         * @param time_step Current time step
-         **/
-        void calcMass( int time_step ) {
-            // Get Domain Iteration Space
-            auto domain = _pm->mesh()->domainSpace();
+            // Overlap Halo Exchanges with the Interior of the Next Time Step
+            _overlap = !cl.exchange.compare( "overlap" );
 
-            // Get State Views
-            auto hNew = _pm->get( Location::Cell(), Field::Height(), NEWFIELD( time_step ) );
-            auto uNew = _pm->get( Location::Cell(), Field::Momentum(), NEWFIELD( time_step ) );
+            _pm = std::make_shared<ProblemManager<ExaCLAMR::RegularMesh<state_t, storage_t>, MemorySpace, ExecutionSpace, OrderingView>>( cl, partitioner, comm, create_functor );
 
-            state_t summed_height = 0, total_height = 0;
+// Create Silo Writer
+#ifdef HAVE_SILO
+            _silo = std::make_shared<SiloWriter<ExaCLAMR::RegularMesh<state_t, storage_t>, MemorySpace, ExecutionSpace, OrderingView>>( _pm );
+#endif
 
-            // Only Loop if Rank is the Specified Rank
-            Kokkos::parallel_reduce(
-                Cajita::createExecutionPolicy( domain, ExecutionSpace() ), KOKKOS_LAMBDA( const int i, const int j, const int k, state_t &l_height ) {
-                    l_height += hNew( i, j, k, 0 );
-                },
-                Kokkos::Sum<state_t>( summed_height ) );
+            _diagnostics = std::make_shared<Diagnostics<state_t>>( cl, comm );
 
-            // Get Total Height
-            MPI_Allreduce( &summed_height, &total_height, 1, Cajita::MpiTraits<state_t>::type(), MPI_SUM, MPI_COMM_WORLD );
+            MPI_Barrier( MPI_COMM_WORLD );
 
-            if ( time_step == 0 )
-                _initial_mass = total_height;
-            else
-                _current_mass = total_height;
+            // Initial Diagnostics of the System
+            _initial_diagnostics = _diagnostics->allreduce( TimeIntegrator::reduceDiagnostics( *_pm, ExecutionSpace(), _gravity, _sigma, Diagnostics<state_t>::all(), 1 ) );
         };
 
         /**
@@ -201,11 +298,8 @@ namespace ExaCLAMR {
             auto hNew = _pm->get( Location::Cell(), Field::Height(), NEWFIELD( time_step ) );
             auto uNew = _pm->get( Location::Cell(), Field::Momentum(), NEWFIELD( time_step ) );
 
-            auto hHost = Kokkos::create_mirror_view( hNew );
-            auto uHost = Kokkos::create_mirror_view( uNew );
-
-            Kokkos::deep_copy( hHost, hNew );
-            Kokkos::deep_copy( uHost, uNew );
+            auto hHost = stateToHost( hNew );
+            auto uHost = stateToHost( uNew );
 
             // Only Loop if Rank is the Specified Rank
             if ( _pm->mesh()->rank() == rank ) {
@@ -238,7 +332,7 @@ namespace ExaCLAMR {
             // Rank 0 Prints Initial Iteration and Time
             if ( _rank == 0 ) {
                 // Print Iteration and Current Time
-                std::cout << std::left << std::setw( 12 ) << "Iteration: " << std::left << std::setw( 12 ) << 0 << std::left << std::setw( 15 ) << "Current Time: " << std::left << std::setw( 12 ) << current_time << std::left << std::setw( 15 ) << "Total Mass: " << std::left << std::setw( 12 ) << _initial_mass << "\n";
+                std::cout << std::left << std::setw( 12 ) << "Iteration: " << std::left << std::setw( 12 ) << 0 << std::left << std::setw( 15 ) << "Current Time: " << std::left << std::setw( 12 ) << current_time << std::left << std::setw( 15 ) << "Total Mass: " << std::left << std::setw( 12 ) << _initial_diagnostics.mass << "\n";
 
                 // DEBUG: Call Output Routine
                 if ( DEBUG ) output( 0, time_step, current_time, mindt );
@@ -249,41 +343,138 @@ namespace ExaCLAMR {
             _silo->siloWrite( strdup( "Mesh" ), 0, current_time, mindt );
 #endif
 
+            bool fuse_dt = ( _timestep == TimeIntegrator::TimeStepType::FUSED );
+            bool lag_dt  = ( _timestep == TimeIntegrator::TimeStepType::LAGGED );
+
+            // Deep Halo: After Each Exchange the Halo is Valid for Exchange Interval Time Steps
+            // Each Time Step Updates the Domain and a Redundant Ghost Region Two Cells Shallower than the Last
+            int max_depth = 2 * ( _exchange_interval - 1 );
+
+            // Fill Boundaries of the Initial State - Later States are Filled with the Halo Exchange
+            timer.computeStart();
+            TimeIntegrator::applyBoundaryConditions( *_pm, ExecutionSpace(), _bc, max_depth, 1 );
+            timer.computeStop();
+
+            // Fused Time Step: The Initial Time Step Comes from the Initial Diagnostics
+            if ( fuse_dt ) mindt = _initial_diagnostics.dt;
+
+            // Overlapped Halo Exchange Started by the Previous Time Step and not yet Finished
+            bool exchanging = false;
+
+            // Lagged Time Step: Time Step of the Previous State and Number of Time Steps Recomputed
+            state_t lagged_dt = 0.0;
+            int     rollbacks = 0;
+
+            // Rebalancing: Time Step and Compute Time of the Last Measurement, Number of Measurements and Migrations
+            int           last_rebalance = 0;
+            long long int last_compute   = timer.computeTime();
+            int           measurements   = 0;
+            int           rebalances     = 0;
+
             // Loop Over Time
             for ( time_step = 1; time_step <= nt; time_step++ ) {
-                timer.computeStart();
-                // Calculate Time Step
-                state_t dt = TimeIntegrator::setTimeStep( *_pm, ExecutionSpace(), _gravity, _sigma, time_step );
-                timer.computeStop();
+                // Lagged Time Step: Advance with the Previous State's Time Step Scaled by the Safety Factor
+                // The Current State's Time Step is Reduced Behind the Calculation and Validates it Afterwards
+                bool        lagging    = ( lag_dt && time_step > 1 );
+                state_t     dt         = 0.0;
+                state_t     state_dt   = 0.0;
+                MPI_Request dt_request = MPI_REQUEST_NULL;
+
+                if ( !fuse_dt ) {
+                    timer.computeStart();
+                    // Calculate Time Step
+                    dt = TimeIntegrator::setTimeStep( *_pm, ExecutionSpace(), _gravity, _sigma, time_step );
+                    timer.computeStop();
+
+                    timer.communicationStart();
+                    // Get Minimum Time Step
+                    if ( lagging ) {
+                        MPI_Iallreduce( &dt, &state_dt, 1, Cajita::MpiTraits<state_t>::type(), MPI_MIN, MPI_COMM_WORLD, &dt_request );
+                        mindt = _safety * lagged_dt;
+                    } else {
+                        MPI_Allreduce( &dt, &mindt, 1, Cajita::MpiTraits<state_t>::type(), MPI_MIN, MPI_COMM_WORLD );
+                        lagged_dt = mindt;
+                    }
+                    timer.communicationStop();
+                }
 
-                timer.communicationStart();
-                // Get Minimum Time Step
-                MPI_Allreduce( &dt, &mindt, 1, Cajita::MpiTraits<state_t>::type(), MPI_MIN, MPI_COMM_WORLD );
-                timer.communicationStop();
+                // Redundant Ghost Cells Updated this Time Step
+                int depth = max_depth - 2 * ( ( time_step - 1 ) % _exchange_interval );
+
+                // Diagnostics Due this Time Step - the Next Time Step is Always Needed if Fused
+                int due         = _diagnostics->due( time_step );
+                int diagnostics = due | ( fuse_dt ? DiagnosticType::bit( DiagnosticType::DT ) : 0 );
 
                 timer.computeStart();
-                // Perform Calculation
-                TimeIntegrator::step( *_pm, ExecutionSpace(), _bc, mindt, _gravity, time_step );
+                // Perform Calculation - Reduces Diagnostics of the New State in the Same Pass
+                DiagnosticValues<state_t> local_diagnostics;
+                if ( exchanging ) {
+                    // Interior Cells Read no Ghost Cells - Update them While the Halo Exchange is in Flight
+                    local_diagnostics = update( mindt, diagnostics, _pm->mesh()->interiorSpace( 2 ), time_step );
+                    timer.computeStop();
+
+                    timer.communicationStart();
+                    TimeIntegrator::haloExchangeFinish( *_pm, ExecutionSpace(), _bc, max_depth, time_step - 1 );
+                    exchanging = false;
+                    timer.communicationStop();
+
+                    // Shell of Cells Around the Interior Once Ghost Cells are Valid
+                    timer.computeStart();
+                    for ( int boundary : { 0, 1, 3, 4 } ) {
+                        auto shell = _pm->mesh()->shellSpace( boundary, 2, depth );
+                        if ( shell.size() > 0 ) diagnosticsJoin( local_diagnostics, update( mindt, diagnostics, shell, time_step ) );
+                    }
+                } else {
+                    local_diagnostics = update( mindt, diagnostics, _pm->mesh()->domainSpace( depth ), time_step );
+                }
                 timer.computeStop();
 
+                if ( lagging ) {
+                    timer.communicationStart();
+                    MPI_Wait( &dt_request, MPI_STATUS_IGNORE );
+                    lagged_dt = state_dt;
+                    timer.communicationStop();
+
+                    // Roll Back if the Time Step Violated the CFL Condition of the Current State
+                    // The Current State is Untouched by the Update - Recompute the New State from it with its Own Time Step
+                    if ( mindt > state_dt ) {
+                        mindt = state_dt;
+                        rollbacks++;
+
+                        timer.computeStart();
+                        local_diagnostics = update( mindt, diagnostics, _pm->mesh()->domainSpace( depth ), time_step );
+                        timer.computeStop();
+                    }
+                }
+
                 timer.communicationStart();
-                // Halo Exchange
-                TimeIntegrator::haloExchange<state_t>( *_pm, ExecutionSpace(), time_step );
-                timer.communicationStop();
+                // Halo Exchange Once the Redundant Ghost Region is Used Up, Boundary Fill Every Time Step
+                if ( depth == 0 && _overlap ) {
+                    TimeIntegrator::haloExchangeStart( *_pm, ExecutionSpace(), time_step );
+                    exchanging = true;
+                } else if ( depth == 0 ) {
+                    TimeIntegrator::haloExchange<state_t>( *_pm, ExecutionSpace(), _bc, max_depth, time_step );
+                } else {
+                    TimeIntegrator::applyBoundaryConditions( *_pm, ExecutionSpace(), _bc, depth - 2, time_step + 1 );
+                }
 
-                timer.computeStart();
-                calcMass( time_step );
-                state_t mass_change = _initial_mass - _current_mass;
-                timer.computeStop();
+                // Reduce Every Diagnostic Due this Time Step in a Single Allreduce
+                DiagnosticValues<state_t> global_diagnostics = local_diagnostics;
+                if ( diagnostics ) global_diagnostics = _diagnostics->allreduce( local_diagnostics );
+                timer.communicationStop();
 
                 // Increment Current Time
                 current_time += mindt;
 
                 // Output and Write File every Write Frequency Time Steps
                 timer.writeStart();
-                if ( 0 == time_step % write_freq ) {
-                    if ( 0 == _rank ) std::cout << std::left << std::setw( 12 ) << "Iteration: " << std::left << std::setw( 12 ) << time_step << std::left << std::setw( 15 ) << "Current Time: " << std::left << std::setw( 12 ) << current_time << std::left << std::setw( 15 ) << "Mass Change: " << std::left << std::setw( 12 ) << mass_change << "\n";
+                if ( 0 == _rank && ( due || 0 == time_step % write_freq ) ) {
+                    std::cout << std::left << std::setw( 12 ) << "Iteration: " << std::left << std::setw( 12 ) << time_step << std::left << std::setw( 15 ) << "Current Time: " << std::left << std::setw( 12 ) << current_time;
+                    _diagnostics->print( due, global_diagnostics, _initial_diagnostics );
+                    std::cout << "\n";
+                }
 
+                if ( 0 == time_step % write_freq ) {
                     // DEBUG: Call Output Routine
                     if ( DEBUG ) output( 0, time_step, current_time, mindt );
 
@@ -293,25 +484,134 @@ namespace ExaCLAMR {
 #endif
                 }
                 timer.writeStop();
+
+                // Advance to the Time Step Reduced from the New State
+                if ( fuse_dt ) mindt = global_diagnostics.dt;
+
+                // Rebalance on the Compute Time Measured Since the Last Rebalance Interval, Only Once the Halo is Exchanged
+                if ( _rebalance_interval && depth == 0 && time_step - last_rebalance >= _rebalance_interval && time_step < nt ) {
+                    timer.communicationStart();
+                    if ( exchanging ) {
+                        TimeIntegrator::haloExchangeFinish( *_pm, ExecutionSpace(), _bc, max_depth, time_step );
+                        exchanging = false;
+                    }
+
+                    double cost = timer.computeTime() - last_compute;
+                    if ( rebalance( cost, max_depth, time_step ) ) rebalances++;
+                    measurements++;
+                    timer.communicationStop();
+
+                    last_rebalance = time_step;
+                    last_compute   = timer.computeTime();
+                }
             }
+
+            // Finish the Halo Exchange of the Final State
+            if ( exchanging ) {
+                timer.communicationStart();
+                TimeIntegrator::haloExchangeFinish( *_pm, ExecutionSpace(), _bc, max_depth, nt );
+                timer.communicationStop();
+            }
+
+            // Rank 0 Prints the Number of Lagged Time Steps that Violated the CFL Condition
+            if ( _rank == 0 && lag_dt ) std::cout << "Lagged Time Step Rollbacks: " << rollbacks << " of " << nt << " Time Steps\n";
+
+            // Rank 0 Prints the Number of Times the State was Migrated to a Rebalanced Decomposition
+            if ( _rank == 0 && _rebalance_interval ) std::cout << "Rebalances: " << rebalances << " of " << measurements << " Measurements\n";
         };
 
       private:
-        int _rank;       /**< Rank of solver */
-        int _time_steps; /**< Number of time steps to solve for */
-        int _halo_size;  /**< Halo size of the mesh */
+        /**
+         * Rebalance the Decomposition on the Measured Cost of Each Rank
+         * Moves the block edges to balance the cost, migrates the new state to a problem manager split at them and exchanges its halo
+         * The halo of the new state must be exchanged before the call
+         * @param cost Compute time of this rank since the last rebalance
+         * @param max_depth Depth of the redundant ghost region
+         * @param time_step Current time step
+         * @return Whether the imbalance exceeded the tolerance and the state was migrated
+         **/
+        bool rebalance( const double cost, const int max_depth, const int time_step ) {
+            double imbalance = costImbalance( cost, _comm );
+            if ( imbalance < rebalance_tolerance ) return false;
+
+            auto mesh  = _pm->mesh();
+            auto edges = balancedEdges( *mesh, cost, _halo_size, _cl.periodic );
+            if ( edges[0] == mesh->blockEdges( 0 ) && edges[1] == mesh->blockEdges( 1 ) ) return false;
+
+            // Same Ranks per Dimension, New Block Edges
+            auto &             global_grid = mesh->localGrid()->globalGrid();
+            std::array<int, 3> ranks_per_dim;
+            for ( int dim = 0; dim < 3; dim++ ) ranks_per_dim[dim] = global_grid.dimNumBlock( dim );
+
+            auto pm = std::make_shared<ProblemManager<ExaCLAMR::RegularMesh<state_t, storage_t>, MemorySpace, ExecutionSpace, OrderingView>>( _cl, Cajita::ManualPartitioner( ranks_per_dim ), _comm, edges );
+            migrateState( *_pm, *pm, NEWFIELD( time_step ) );
+            _pm = pm;
+
+// Write to the New Decomposition
+#ifdef HAVE_SILO
+            _silo = std::make_shared<SiloWriter<ExaCLAMR::RegularMesh<state_t, storage_t>, MemorySpace, ExecutionSpace, OrderingView>>( _pm );
+#endif
+
+            TimeIntegrator::haloExchange<state_t>( *_pm, ExecutionSpace(), _bc, max_depth, time_step );
+
+            // Rank 0 Prints the Imbalance and the New Edges
+            if ( _rank == 0 ) {
+                std::cout << "Rebalanced at Iteration " << time_step << " - Imbalance: " << imbalance;
+                for ( int dim = 0; dim < 2; dim++ ) {
+                    std::cout << ( dim ? " Y" : " X" ) << " Edges:";
+                    for ( int edge : edges[dim] ) std::cout << " " << edge;
+                }
+                std::cout << "\n";
+            }
+
+            return true;
+        }
+
+        /**
+         * Update the Cells of an Index Space with the Selected Finite Volume Kernel
+         * @param dt Time step (dt)
+         * @param diagnostics Mask of diagnostics to reduce from the new state values
+         * @param domain Cells to update
+         * @param time_step Current time step
+         * @return Local diagnostics of the updated cells
+         **/
+        DiagnosticValues<state_t> update( const state_t dt, const int diagnostics, const Cajita::IndexSpace<3> &domain, const int time_step ) {
+            if ( _kernel == TimeIntegrator::KernelType::FACE )
+                return TimeIntegrator::faceStep( *_pm, ExecutionSpace(), dt, _gravity, _sigma, diagnostics, domain, time_step );
+            else if ( _kernel == TimeIntegrator::KernelType::TILED )
+                return TimeIntegrator::tiledStep( *_pm, ExecutionSpace(), dt, _gravity, _sigma, diagnostics, _tile, domain, time_step );
+            else if ( _kernel == TimeIntegrator::KernelType::SIMD )
+                return TimeIntegrator::simdStep( *_pm, ExecutionSpace(), dt, _gravity, _sigma, diagnostics, domain, time_step );
+            else
+                return TimeIntegrator::step( *_pm, ExecutionSpace(), dt, _gravity, _sigma, diagnostics, domain, time_step );
+        }
+
+        int  _rank;               /**< Rank of solver */
+        int  _time_steps;         /**< Number of time steps to solve for */
+        int  _halo_size;          /**< Halo size of the mesh */
+        int  _exchange_interval;  /**< Time steps between halo exchanges */
+        int  _rebalance_interval; /**< Time steps between load balance measurements */
+        int  _kernel;             /**< Finite volume kernel type */
+        int  _timestep;           /**< Time step calculation type */
+        bool _overlap;            /**< Overlap halo exchanges with interior computation */
+
+        std::array<int, 2> _tile; /**< Tile size of the tiled kernel */
 
-        state_t _gravity;      /**< Gravitational constant */
-        state_t _sigma;        /**< Sigma used to control CFL number and calculate time step */
-        state_t _initial_mass; /**< Initial mass of the system */
-        state_t _current_mass; /**< Current mass of the system */
+        state_t _gravity; /**< Gravitational constant */
+        state_t _sigma;   /**< Sigma used to control CFL number and calculate time step */
+        state_t _safety;  /**< Safety factor of the lagged time step */
 
-        std::shared_ptr<ProblemManager<ExaCLAMR::RegularMesh<state_t>, MemorySpace, ExecutionSpace, OrderingView>> _pm; /**< Problem Manager object */
+        DiagnosticValues<state_t>             _initial_diagnostics; /**< Diagnostics of the initial state */
+        std::shared_ptr<Diagnostics<state_t>> _diagnostics;         /**< Diagnostics cadence and reduction */
+
+        std::shared_ptr<ProblemManager<ExaCLAMR::RegularMesh<state_t, storage_t>, MemorySpace, ExecutionSpace, OrderingView>> _pm; /**< Problem Manager object */
 #ifdef HAVE_SILO
-        std::shared_ptr<SiloWriter<ExaCLAMR::RegularMesh<state_t>, MemorySpace, ExecutionSpace, OrderingView>> _silo; /**< Silo writer object */
+        std::shared_ptr<SiloWriter<ExaCLAMR::RegularMesh<state_t, storage_t>, MemorySpace, ExecutionSpace, OrderingView>> _silo; /**< Silo writer object */
 #endif
 
-        ExaCLAMR::BoundaryCondition _bc; /**< Boundary conditions */
+        ExaCLAMR::ClArgs<state_t> _cl;   /**< Command line arguments the problem manager is rebuilt from */
+        BoundaryPolicyType        _bc;   /**< Boundary policy */
+        MPI_Comm                  _comm; /**< MPI communicator */
     };
 
     /**
@@ -335,7 +635,31 @@ namespace ExaCLAMR {
         if ( 0 == cl.device.compare( "serial" ) ) {
 #ifdef KOKKOS_ENABLE_SERIAL
             if ( !cl.ordering.compare( "hilbert" ) ) {
-                return std::make_shared<ExaCLAMR::Solver<ExaCLAMR::AMRMesh<state_t>, Kokkos::HostSpace, Kokkos::Serial, Kokkos::LayoutHilbert2D>>(
+                return std::make_shared<ExaCLAMR::Solver<ExaCLAMR::AMRMesh<state_t>, Kokkos::HostSpace, Kokkos::Serial, ExaCLAMR::LayoutHilbert2D>>(
+                    cl,
+                    bc,
+                    comm,
+                    create_functor,
+                    partitioner,
+                    timer );
+            } else if ( !cl.ordering.compare( "morton" ) ) {
+                return std::make_shared<ExaCLAMR::Solver<ExaCLAMR::AMRMesh<state_t>, Kokkos::HostSpace, Kokkos::Serial, Kokkos::LayoutMorton2D>>(
+                    cl,
+                    bc,
+                    comm,
+                    create_functor,
+                    partitioner,
+                    timer );
+            } else if ( !cl.ordering.compare( "tiled" ) ) {
+                return std::make_shared<ExaCLAMR::Solver<ExaCLAMR::AMRMesh<state_t>, Kokkos::HostSpace, Kokkos::Serial, Kokkos::LayoutTiled2D<EXACLAMR_LAYOUT_TILE>>>(
+                    cl,
+                    bc,
+                    comm,
+                    create_functor,
+                    partitioner,
+                    timer );
+            } else if ( !cl.ordering.compare( "aosoa" ) ) {
+                return std::make_shared<ExaCLAMR::Solver<ExaCLAMR::AMRMesh<state_t>, Kokkos::HostSpace, Kokkos::Serial, Kokkos::LayoutCellAoSoA<EXACLAMR_AOSOA_VECTOR>>>(
                     cl,
                     bc,
                     comm,
@@ -359,7 +683,31 @@ namespace ExaCLAMR {
         else if ( 0 == cl.device.compare( "openmp" ) ) {
 #ifdef KOKKOS_ENABLE_OPENMP
             if ( !cl.ordering.compare( "hilbert" ) ) {
-                return std::make_shared<ExaCLAMR::Solver<ExaCLAMR::AMRMesh<state_t>, Kokkos::HostSpace, Kokkos::OpenMP, Kokkos::LayoutHilbert2D>>(
+                return std::make_shared<ExaCLAMR::Solver<ExaCLAMR::AMRMesh<state_t>, Kokkos::HostSpace, Kokkos::OpenMP, ExaCLAMR::LayoutHilbert2D>>(
+                    cl,
+                    bc,
+                    comm,
+                    create_functor,
+                    partitioner,
+                    timer );
+            } else if ( !cl.ordering.compare( "morton" ) ) {
+                return std::make_shared<ExaCLAMR::Solver<ExaCLAMR::AMRMesh<state_t>, Kokkos::HostSpace, Kokkos::OpenMP, Kokkos::LayoutMorton2D>>(
+                    cl,
+                    bc,
+                    comm,
+                    create_functor,
+                    partitioner,
+                    timer );
+            } else if ( !cl.ordering.compare( "tiled" ) ) {
+                return std::make_shared<ExaCLAMR::Solver<ExaCLAMR::AMRMesh<state_t>, Kokkos::HostSpace, Kokkos::OpenMP, Kokkos::LayoutTiled2D<EXACLAMR_LAYOUT_TILE>>>(
+                    cl,
+                    bc,
+                    comm,
+                    create_functor,
+                    partitioner,
+                    timer );
+            } else if ( !cl.ordering.compare( "aosoa" ) ) {
+                return std::make_shared<ExaCLAMR::Solver<ExaCLAMR::AMRMesh<state_t>, Kokkos::HostSpace, Kokkos::OpenMP, Kokkos::LayoutCellAoSoA<EXACLAMR_AOSOA_VECTOR>>>(
                     cl,
                     bc,
                     comm,
@@ -383,7 +731,31 @@ namespace ExaCLAMR {
         else if ( 0 == cl.device.compare( "cuda" ) ) {
 #ifdef KOKKOS_ENABLE_CUDA
             if ( !cl.ordering.compare( "hilbert" ) ) {
-                return std::make_shared<ExaCLAMR::Solver<ExaCLAMR::AMRMesh<state_t>, Kokkos::CudaSpace, Kokkos::Cuda, Kokkos::LayoutHilbert2D>>(
+                return std::make_shared<ExaCLAMR::Solver<ExaCLAMR::AMRMesh<state_t>, Kokkos::CudaSpace, Kokkos::Cuda, ExaCLAMR::LayoutHilbert2D>>(
+                    cl,
+                    bc,
+                    comm,
+                    create_functor,
+                    partitioner,
+                    timer );
+            } else if ( !cl.ordering.compare( "morton" ) ) {
+                return std::make_shared<ExaCLAMR::Solver<ExaCLAMR::AMRMesh<state_t>, Kokkos::CudaSpace, Kokkos::Cuda, Kokkos::LayoutMorton2D>>(
+                    cl,
+                    bc,
+                    comm,
+                    create_functor,
+                    partitioner,
+                    timer );
+            } else if ( !cl.ordering.compare( "tiled" ) ) {
+                return std::make_shared<ExaCLAMR::Solver<ExaCLAMR::AMRMesh<state_t>, Kokkos::CudaSpace, Kokkos::Cuda, Kokkos::LayoutTiled2D<EXACLAMR_LAYOUT_TILE>>>(
+                    cl,
+                    bc,
+                    comm,
+                    create_functor,
+                    partitioner,
+                    timer );
+            } else if ( !cl.ordering.compare( "aosoa" ) ) {
+                return std::make_shared<ExaCLAMR::Solver<ExaCLAMR::AMRMesh<state_t>, Kokkos::CudaSpace, Kokkos::Cuda, Kokkos::LayoutCellAoSoA<EXACLAMR_AOSOA_VECTOR>>>(
                     cl,
                     bc,
                     comm,
@@ -410,7 +782,7 @@ namespace ExaCLAMR {
     };
 
     /**
- * Create Solver Pointer with Templates based on specified ExecutionSpace and MemorySpace
+ * Create Solver Pointer with Templates based on specified ExecutionSpace, MemorySpace, State Storage Precision and Boundary Policy
  * @param cl Command line arguments
  * @param bc Boundary condition
  * @param comm MPI communicator
@@ -418,8 +790,8 @@ namespace ExaCLAMR {
  * @param partitioner Cajita MPI Partitioner
  * @param timer ExaCLAMR timer to profile performance
 **/
-    template <typename state_t, class InitFunc>
-    std::shared_ptr<ExaCLAMR::SolverBase<ExaCLAMR::RegularMesh<state_t>>> createRegularSolver(
+    template <typename state_t, typename storage_t, class BoundaryPolicyType, class InitFunc>
+    std::shared_ptr<ExaCLAMR::SolverBase<ExaCLAMR::RegularMesh<state_t>>> createRegularStorageSolver(
         const ExaCLAMR::ClArgs<state_t> &  cl,
         const ExaCLAMR::BoundaryCondition &bc,
         MPI_Comm                           comm,
@@ -431,7 +803,31 @@ namespace ExaCLAMR {
         if ( 0 == cl.device.compare( "serial" ) ) {
 #ifdef KOKKOS_ENABLE_SERIAL
             if ( !cl.ordering.compare( "hilbert" ) ) {
-                return std::make_shared<ExaCLAMR::Solver<ExaCLAMR::RegularMesh<state_t>, Kokkos::HostSpace, Kokkos::Serial, Kokkos::LayoutHilbert2D>>(
+                return std::make_shared<ExaCLAMR::Solver<ExaCLAMR::RegularMesh<state_t, storage_t>, Kokkos::HostSpace, Kokkos::Serial, ExaCLAMR::LayoutHilbert2D, BoundaryPolicyType>>(
+                    cl,
+                    bc,
+                    comm,
+                    create_functor,
+                    partitioner,
+                    timer );
+            } else if ( !cl.ordering.compare( "morton" ) ) {
+                return std::make_shared<ExaCLAMR::Solver<ExaCLAMR::RegularMesh<state_t, storage_t>, Kokkos::HostSpace, Kokkos::Serial, Kokkos::LayoutMorton2D, BoundaryPolicyType>>(
+                    cl,
+                    bc,
+                    comm,
+                    create_functor,
+                    partitioner,
+                    timer );
+            } else if ( !cl.ordering.compare( "tiled" ) ) {
+                return std::make_shared<ExaCLAMR::Solver<ExaCLAMR::RegularMesh<state_t, storage_t>, Kokkos::HostSpace, Kokkos::Serial, Kokkos::LayoutTiled2D<EXACLAMR_LAYOUT_TILE>, BoundaryPolicyType>>(
+                    cl,
+                    bc,
+                    comm,
+                    create_functor,
+                    partitioner,
+                    timer );
+            } else if ( !cl.ordering.compare( "aosoa" ) ) {
+                return std::make_shared<ExaCLAMR::Solver<ExaCLAMR::RegularMesh<state_t, storage_t>, Kokkos::HostSpace, Kokkos::Serial, Kokkos::LayoutCellAoSoA<EXACLAMR_AOSOA_VECTOR>, BoundaryPolicyType>>(
                     cl,
                     bc,
                     comm,
@@ -439,7 +835,7 @@ namespace ExaCLAMR {
                     partitioner,
                     timer );
             } else {
-                return std::make_shared<ExaCLAMR::Solver<ExaCLAMR::RegularMesh<state_t>, Kokkos::HostSpace, Kokkos::Serial, Kokkos::LayoutRight>>(
+                return std::make_shared<ExaCLAMR::Solver<ExaCLAMR::RegularMesh<state_t, storage_t>, Kokkos::HostSpace, Kokkos::Serial, Kokkos::LayoutRight, BoundaryPolicyType>>(
                     cl,
                     bc,
                     comm,
@@ -455,7 +851,31 @@ namespace ExaCLAMR {
         else if ( 0 == cl.device.compare( "openmp" ) ) {
 #ifdef KOKKOS_ENABLE_OPENMP
             if ( !cl.ordering.compare( "hilbert" ) ) {
-                return std::make_shared<ExaCLAMR::Solver<ExaCLAMR::RegularMesh<state_t>, Kokkos::HostSpace, Kokkos::OpenMP, Kokkos::LayoutHilbert2D>>(
+                return std::make_shared<ExaCLAMR::Solver<ExaCLAMR::RegularMesh<state_t, storage_t>, Kokkos::HostSpace, Kokkos::OpenMP, ExaCLAMR::LayoutHilbert2D, BoundaryPolicyType>>(
+                    cl,
+                    bc,
+                    comm,
+                    create_functor,
+                    partitioner,
+                    timer );
+            } else if ( !cl.ordering.compare( "morton" ) ) {
+                return std::make_shared<ExaCLAMR::Solver<ExaCLAMR::RegularMesh<state_t, storage_t>, Kokkos::HostSpace, Kokkos::OpenMP, Kokkos::LayoutMorton2D, BoundaryPolicyType>>(
+                    cl,
+                    bc,
+                    comm,
+                    create_functor,
+                    partitioner,
+                    timer );
+            } else if ( !cl.ordering.compare( "tiled" ) ) {
+                return std::make_shared<ExaCLAMR::Solver<ExaCLAMR::RegularMesh<state_t, storage_t>, Kokkos::HostSpace, Kokkos::OpenMP, Kokkos::LayoutTiled2D<EXACLAMR_LAYOUT_TILE>, BoundaryPolicyType>>(
+                    cl,
+                    bc,
+                    comm,
+                    create_functor,
+                    partitioner,
+                    timer );
+            } else if ( !cl.ordering.compare( "aosoa" ) ) {
+                return std::make_shared<ExaCLAMR::Solver<ExaCLAMR::RegularMesh<state_t, storage_t>, Kokkos::HostSpace, Kokkos::OpenMP, Kokkos::LayoutCellAoSoA<EXACLAMR_AOSOA_VECTOR>, BoundaryPolicyType>>(
                     cl,
                     bc,
                     comm,
@@ -463,7 +883,7 @@ namespace ExaCLAMR {
                     partitioner,
                     timer );
             } else {
-                return std::make_shared<ExaCLAMR::Solver<ExaCLAMR::RegularMesh<state_t>, Kokkos::HostSpace, Kokkos::OpenMP, Kokkos::LayoutRight>>(
+                return std::make_shared<ExaCLAMR::Solver<ExaCLAMR::RegularMesh<state_t, storage_t>, Kokkos::HostSpace, Kokkos::OpenMP, Kokkos::LayoutRight, BoundaryPolicyType>>(
                     cl,
                     bc,
                     comm,
@@ -479,7 +899,31 @@ namespace ExaCLAMR {
         else if ( 0 == cl.device.compare( "cuda" ) ) {
 #ifdef KOKKOS_ENABLE_CUDA
             if ( !cl.ordering.compare( "hilbert" ) ) {
-                return std::make_shared<ExaCLAMR::Solver<ExaCLAMR::RegularMesh<state_t>, Kokkos::CudaSpace, Kokkos::Cuda, Kokkos::LayoutHilbert2D>>(
+                return std::make_shared<ExaCLAMR::Solver<ExaCLAMR::RegularMesh<state_t, storage_t>, Kokkos::CudaSpace, Kokkos::Cuda, ExaCLAMR::LayoutHilbert2D, BoundaryPolicyType>>(
+                    cl,
+                    bc,
+                    comm,
+                    create_functor,
+                    partitioner,
+                    timer );
+            } else if ( !cl.ordering.compare( "morton" ) ) {
+                return std::make_shared<ExaCLAMR::Solver<ExaCLAMR::RegularMesh<state_t, storage_t>, Kokkos::CudaSpace, Kokkos::Cuda, Kokkos::LayoutMorton2D, BoundaryPolicyType>>(
+                    cl,
+                    bc,
+                    comm,
+                    create_functor,
+                    partitioner,
+                    timer );
+            } else if ( !cl.ordering.compare( "tiled" ) ) {
+                return std::make_shared<ExaCLAMR::Solver<ExaCLAMR::RegularMesh<state_t, storage_t>, Kokkos::CudaSpace, Kokkos::Cuda, Kokkos::LayoutTiled2D<EXACLAMR_LAYOUT_TILE>, BoundaryPolicyType>>(
+                    cl,
+                    bc,
+                    comm,
+                    create_functor,
+                    partitioner,
+                    timer );
+            } else if ( !cl.ordering.compare( "aosoa" ) ) {
+                return std::make_shared<ExaCLAMR::Solver<ExaCLAMR::RegularMesh<state_t, storage_t>, Kokkos::CudaSpace, Kokkos::Cuda, Kokkos::LayoutCellAoSoA<EXACLAMR_AOSOA_VECTOR>, BoundaryPolicyType>>(
                     cl,
                     bc,
                     comm,
@@ -487,7 +931,7 @@ namespace ExaCLAMR {
                     partitioner,
                     timer );
             } else {
-                return std::make_shared<ExaCLAMR::Solver<ExaCLAMR::RegularMesh<state_t>, Kokkos::CudaSpace, Kokkos::Cuda, Kokkos::LayoutLeft>>(
+                return std::make_shared<ExaCLAMR::Solver<ExaCLAMR::RegularMesh<state_t, storage_t>, Kokkos::CudaSpace, Kokkos::Cuda, Kokkos::LayoutLeft, BoundaryPolicyType>>(
                     cl,
                     bc,
                     comm,
@@ -505,6 +949,45 @@ namespace ExaCLAMR {
         }
     };
 
+    /**
+ * Create Solver Pointer with Templates based on specified Precision, Boundary Conditions, ExecutionSpace and MemorySpace
+ * Mixed precision stores the state as floats while the kernels compute and reduce in the precision of the command line arguments
+ * Boundary conditions with every wall reflective use a compile-time boundary policy, others are applied face by face from their runtime types
+ * @param cl Command line arguments
+ * @param bc Boundary condition
+ * @param comm MPI communicator
+ * @param create_functor Initialization function
+ * @param partitioner Cajita MPI Partitioner
+ * @param timer ExaCLAMR timer to profile performance
+**/
+    template <typename state_t, class InitFunc>
+    std::shared_ptr<ExaCLAMR::SolverBase<ExaCLAMR::RegularMesh<state_t>>> createRegularSolver(
+        const ExaCLAMR::ClArgs<state_t> &  cl,
+        const ExaCLAMR::BoundaryCondition &bc,
+        MPI_Comm                           comm,
+        const InitFunc &                   create_functor,
+        const Cajita::Partitioner &        partitioner,
+        ExaCLAMR::Timer &                  timer ) {
+
+        // Every Wall Reflective - Boundary Types Fixed at Compile Time
+        bool reflective = bc.uniform( BoundaryType::REFLECTIVE );
+
+        // Float Storage
+        if ( 0 == cl.precision.compare( "mixed" ) ) {
+            if ( reflective )
+                return createRegularStorageSolver<state_t, float, ReflectiveBoundaries>( cl, bc, comm, create_functor, partitioner, timer );
+            else
+                return createRegularStorageSolver<state_t, float, BoundaryCondition>( cl, bc, comm, create_functor, partitioner, timer );
+        }
+        // Storage in the Compute Precision ( Double or Float )
+        else {
+            if ( reflective )
+                return createRegularStorageSolver<state_t, state_t, ReflectiveBoundaries>( cl, bc, comm, create_functor, partitioner, timer );
+            else
+                return createRegularStorageSolver<state_t, state_t, BoundaryCondition>( cl, bc, comm, create_functor, partitioner, timer );
+        }
+    };
+
 } // namespace ExaCLAMR
 
 #endif
@@ -0,0 +1,411 @@
+/**
+ * @file
+ * @author Patrick Bridges <pbridges@unm.edu>
+ * @author Jered Dominguez-Trujillo <jereddt@unm.edu>
+ *
+ * @section DESCRIPTION
+ * Space-filling curve indexing of 2-D index spaces
+ * The Hilbert curve visits every cell of a power-of-two square once, stepping only between face neighbors
+ * Index spaces of other shapes are visited in the order of their covering square, skipping the cells outside
+ * The Morton ( Z-order ) curve interleaves the bits of the indices, trading some locality for a few instructions per index
+ */
+
+#ifndef EXACLAMR_SPACEFILLINGCURVE_HPP
+#define EXACLAMR_SPACEFILLINGCURVE_HPP
+
+#ifndef DEBUG
+#define DEBUG 0
+#endif
+
+// Include Statements
+#include <Kokkos_Core.hpp>
+
+#if defined( __BMI2__ )
+#include <immintrin.h>
+#endif
+
+#include <array>
+#include <vector>
+
+namespace ExaCLAMR {
+    namespace SpaceFillingCurve {
+
+        /**
+ * Side of the Smallest Power-of-Two Square Covering an Index Space
+ * @param nx Cells along the first dimension
+ * @param ny Cells along the second dimension
+ * @return Side of the covering square
+ */
+        inline long coveringSide( const long nx, const long ny ) {
+            long side = 1;
+            while ( side < nx || side < ny ) side *= 2;
+            return side;
+        }
+
+        /**
+ * Spread the Bits of an Index to the Even Bits of the Result
+ */
+        KOKKOS_INLINE_FUNCTION
+        unsigned long mortonSpread( const unsigned long v ) {
+#if defined( __BMI2__ ) && !defined( __CUDA_ARCH__ ) && !defined( __HIP_DEVICE_COMPILE__ )
+            return _pdep_u64( v, 0x5555555555555555UL );
+#else
+            unsigned long x = v & 0xffffffffUL;
+            x               = ( x | ( x << 16 ) ) & 0x0000ffff0000ffffUL;
+            x               = ( x | ( x << 8 ) ) & 0x00ff00ff00ff00ffUL;
+            x               = ( x | ( x << 4 ) ) & 0x0f0f0f0f0f0f0f0fUL;
+            x               = ( x | ( x << 2 ) ) & 0x3333333333333333UL;
+            x               = ( x | ( x << 1 ) ) & 0x5555555555555555UL;
+            return x;
+#endif
+        }
+
+        /**
+ * Gather the Even Bits of a Morton Index
+ */
+        KOKKOS_INLINE_FUNCTION
+        unsigned long mortonCompact( const unsigned long d ) {
+#if defined( __BMI2__ ) && !defined( __CUDA_ARCH__ ) && !defined( __HIP_DEVICE_COMPILE__ )
+            return _pext_u64( d, 0x5555555555555555UL );
+#else
+            unsigned long x = d & 0x5555555555555555UL;
+            x               = ( x | ( x >> 1 ) ) & 0x3333333333333333UL;
+            x               = ( x | ( x >> 2 ) ) & 0x0f0f0f0f0f0f0f0fUL;
+            x               = ( x | ( x >> 4 ) ) & 0x00ff00ff00ff00ffUL;
+            x               = ( x | ( x >> 8 ) ) & 0x0000ffff0000ffffUL;
+            x               = ( x | ( x >> 16 ) ) & 0x00000000ffffffffUL;
+            return x;
+#endif
+        }
+
+        /**
+ * Position of a Cell Along the Morton Curve - the Second Index Supplies the Even Bits
+ * @param x First index of the cell
+ * @param y Second index of the cell
+ * @return Morton index of the cell
+ */
+        KOKKOS_INLINE_FUNCTION
+        long mortonIndex( const long x, const long y ) {
+            return ( mortonSpread( x ) << 1 ) | mortonSpread( y );
+        }
+
+        /**
+ * Cell at a Position Along the Morton Curve
+ * @param d Morton index of the cell
+ * @param x First index of the cell
+ * @param y Second index of the cell
+ */
+        KOKKOS_INLINE_FUNCTION
+        void mortonCoords( const long d, long &x, long &y ) {
+            x = mortonCompact( d >> 1 );
+            y = mortonCompact( d );
+        }
+
+        /**
+ * Rotate and Flip a Quadrant so its Sub-Curve Runs the Same Way as the Parent Curve
+ */
+        KOKKOS_INLINE_FUNCTION
+        void hilbertRotate( const long side, long &x, long &y, const long rx, const long ry ) {
+            if ( ry == 0 ) {
+                if ( rx == 1 ) {
+                    x = side - 1 - x;
+                    y = side - 1 - y;
+                }
+                long t = x;
+                x      = y;
+                y      = t;
+            }
+        }
+
+        /**
+ * Position of a Cell Along the Hilbert Curve of a Square
+ * @param side Side of the square ( power of two )
+ * @param x First index of the cell
+ * @param y Second index of the cell
+ * @return Hilbert index of the cell
+ */
+        KOKKOS_INLINE_FUNCTION
+        long hilbertIndex( const long side, long x, long y ) {
+            long d = 0;
+            for ( long s = side / 2; s > 0; s /= 2 ) {
+                long rx = ( x & s ) > 0;
+                long ry = ( y & s ) > 0;
+                d += s * s * ( ( 3 * rx ) ^ ry );
+                hilbertRotate( side, x, y, rx, ry );
+            }
+            return d;
+        }
+
+        /**
+ * Cell at a Position Along the Hilbert Curve of a Square
+ * @param side Side of the square ( power of two )
+ * @param d Hilbert index of the cell
+ * @param x First index of the cell
+ * @param y Second index of the cell
+ */
+        KOKKOS_INLINE_FUNCTION
+        void hilbertCoords( const long side, const long d, long &x, long &y ) {
+            long t = d;
+            x = y = 0;
+            for ( long s = 1; s < side; s *= 2 ) {
+                long rx = 1 & ( t / 2 );
+                long ry = 1 & ( t ^ rx );
+                hilbertRotate( s, x, y, rx, ry );
+                x += s * rx;
+                y += s * ry;
+                t /= 4;
+            }
+        }
+
+        /**
+ * One Level of the Hilbert State Machine
+ * The state is the transformation the coarser levels apply to the finer bits, one of four that compose by exclusive or:
+ * bit 0 swaps the coordinates, bit 1 complements and swaps them
+ * @param state Transformation of this level's bits
+ * @param bx Bit of the first index at this level
+ * @param by Bit of the second index at this level
+ * @param digit Quadrant of the cell along the curve at this level ( 0 to 3 )
+ * @return Transformation of the next finer level's bits
+ */
+        KOKKOS_INLINE_FUNCTION
+        int hilbertStep( const int state, long bx, long by, long &digit ) {
+            if ( state & 1 ) {
+                long t = bx;
+                bx     = by;
+                by     = t;
+            }
+            if ( state & 2 ) {
+                long t = bx;
+                bx     = 1 - by;
+                by     = 1 - t;
+            }
+            digit = ( 3 * bx ) ^ by;
+            if ( by ) return state;
+            return state ^ ( bx ? 2 : 1 );
+        }
+
+        /**
+ * Position of a Cell Within the Current Block of a Hilbert Cursor
+ * @struct HilbertCursor
+ */
+        struct HilbertCursor {
+            long prefix; /**< Hilbert index of the cell with the bits of the finest table step cleared */
+            int  state;  /**< State of the finest table step */
+            int  x, y;   /**< Indices of the cell within the block of the finest table step */
+        };
+
+        /**
+ * The HilbertTable Class
+ * @class HilbertTable
+ * @brief Table-driven Hilbert index of the cells of a power-of-two square
+ * Each table step maps a state and four bits of each index to eight bits of the Hilbert index and the next state
+ * A cursor keeps the state of the finest step, so the index of a nearby cell in the same 16 x 16 block is a single lookup
+ **/
+        template <class MemorySpace>
+        class HilbertTable {
+          public:
+            typedef Kokkos::View<unsigned short *, MemorySpace> table_view;
+
+            static const int bits = 4; /**< Bits of each index consumed per table step */
+            static const int mask = 15;
+
+            /**
+             * Constructor
+             * Builds the table of every state and pair of four-bit indices from the single-level state machine
+             *
+             * @param side Side of the square ( power of two )
+             */
+            HilbertTable( const long side )
+                : _table( "hilbert_table", 4 << ( 2 * bits ) ) {
+                _order = 0;
+                while ( ( 1L << _order ) < side ) _order++;
+
+                auto table = Kokkos::create_mirror_view( _table );
+                for ( int entry = 0; entry < ( 4 << ( 2 * bits ) ); entry++ ) {
+                    int  state = entry >> ( 2 * bits ), x = ( entry >> bits ) & mask, y = entry & mask;
+                    long digits = 0, digit;
+                    for ( int b = bits - 1; b >= 0; b-- ) {
+                        state  = hilbertStep( state, ( x >> b ) & 1, ( y >> b ) & 1, digit );
+                        digits = ( digits << 2 ) | digit;
+                    }
+                    table( entry ) = digits | ( state << ( 2 * bits ) );
+                }
+                Kokkos::deep_copy( _table, table );
+            };
+
+            /**
+             * Position of a Cell Along the Curve
+             **/
+            KOKKOS_INLINE_FUNCTION
+            long index( const long x, const long y ) const {
+                HilbertCursor c = cursor( x, y );
+                return index( c );
+            };
+
+            /**
+             * Position Along the Curve of the Cell of a Cursor
+             **/
+            KOKKOS_INLINE_FUNCTION
+            long index( const HilbertCursor &c ) const {
+                return c.prefix | ( _table( ( c.state << ( 2 * bits ) ) | ( c.x << bits ) | c.y ) & 0xff );
+            };
+
+            /**
+             * Cursor at a Cell
+             * Walks the levels above the finest table step, a single level at a time until the rest divide into table steps
+             **/
+            KOKKOS_INLINE_FUNCTION
+            HilbertCursor cursor( const long x, const long y ) const {
+                // Squares Smaller than a Table Step are Padded with Leading Zero Levels
+                // A zero level adds a zero digit and toggles the swap, so the padding starts from the state it ends in
+                int  levels = ( _order < bits ) ? bits : _order;
+                int  state  = ( _order < bits && ( ( bits - _order ) & 1 ) ) ? 1 : 0;
+                long d      = 0, digit;
+
+                int level = levels;
+                for ( ; level % bits; level-- ) {
+                    state = hilbertStep( state, ( x >> ( level - 1 ) ) & 1, ( y >> ( level - 1 ) ) & 1, digit );
+                    d     = ( d << 2 ) | digit;
+                }
+                for ( ; level > bits; level -= bits ) {
+                    int entry = _table( ( state << ( 2 * bits ) ) | ( ( ( x >> ( level - bits ) ) & mask ) << bits ) | ( ( y >> ( level - bits ) ) & mask ) );
+                    d         = ( d << ( 2 * bits ) ) | ( entry & 0xff );
+                    state     = entry >> ( 2 * bits );
+                }
+
+                HilbertCursor c;
+                c.prefix = d << ( 2 * bits );
+                c.state  = state;
+                c.x      = x & mask;
+                c.y      = y & mask;
+                return c;
+            };
+
+            /**
+             * Position Along the Curve of a Cell Near the Cell of a Cursor
+             * Cells in the same 16 x 16 block share the cursor's prefix and state and cost one lookup, others walk the levels
+             * @param c Cursor at the cell ( x, y )
+             * @param x First index of the cursor's cell
+             * @param y Second index of the cursor's cell
+             * @param di Offset along the first index
+             * @param dj Offset along the second index
+             **/
+            KOKKOS_INLINE_FUNCTION
+            long neighbor( const HilbertCursor &c, const long x, const long y, const int di, const int dj ) const {
+                int nx = c.x + di, ny = c.y + dj;
+                if ( nx < 0 || nx > mask || ny < 0 || ny > mask ) return index( x + di, y + dj );
+
+                HilbertCursor n = c;
+                n.x             = nx;
+                n.y             = ny;
+                return index( n );
+            };
+
+          private:
+            table_view _table; /**< Eight index bits and the next state of each state and pair of four-bit indices */
+            int        _order; /**< Levels of the square */
+        };
+
+        /**
+ * Hilbert Index of the Cells of One Small Power-of-Two Block
+ * @struct HilbertTile
+ * @brief One table step of HilbertTable from the starting state, held by value so a view offset can carry it to the device
+ */
+        template <int Bits>
+        struct HilbertTile {
+            static_assert( Bits > 0 && Bits <= HilbertTable<Kokkos::HostSpace>::bits, "HilbertTile covers at most one table step" );
+
+            static const int side = 1 << Bits;
+            static const int mask = side - 1;
+
+            unsigned char curve[side * side]; /**< Hilbert index of each cell, row-major */
+
+            /**
+             * Fill the Table from the Single-Level State Machine
+             **/
+            KOKKOS_INLINE_FUNCTION
+            void fill() {
+                for ( int entry = 0; entry < side * side; entry++ ) {
+                    int  state = 0, x = entry >> Bits, y = entry & mask;
+                    long digits = 0, digit;
+                    for ( int b = Bits - 1; b >= 0; b-- ) {
+                        state  = hilbertStep( state, ( x >> b ) & 1, ( y >> b ) & 1, digit );
+                        digits = ( digits << 2 ) | digit;
+                    }
+                    curve[entry] = digits;
+                }
+            };
+
+            /**
+             * Position of a Cell Along the Curve Through the Block
+             **/
+            KOKKOS_INLINE_FUNCTION
+            unsigned index( const unsigned long x, const unsigned long y ) const { return curve[( x << Bits ) | y]; };
+        };
+
+        /**
+ * The HilbertOffsets Class
+ * @class HilbertOffsets
+ * @brief Precomputed Hilbert index of every cell of an index space, for meshes small enough to keep one index per cell
+ **/
+        template <class MemorySpace>
+        class HilbertOffsets {
+          public:
+            typedef Kokkos::View<long **, MemorySpace> offset_view;
+
+            /**
+             * Constructor
+             * Computes the index of every cell once with a Hilbert table
+             *
+             * @param exec_space Execution space
+             * @param nx Cells along the first dimension
+             * @param ny Cells along the second dimension
+             */
+            template <class ExecutionSpace>
+            HilbertOffsets( const ExecutionSpace &exec_space, const int nx, const int ny )
+                : _offsets( "hilbert_offsets", nx, ny ) {
+                HilbertTable<MemorySpace> table( coveringSide( nx, ny ) );
+                offset_view               offsets = _offsets;
+
+                Kokkos::parallel_for(
+                    "Hilbert_Offsets", Kokkos::RangePolicy<ExecutionSpace>( exec_space, 0, (long)nx * ny ), KOKKOS_LAMBDA( const long n ) {
+                        long i = n / ny, j = n % ny;
+                        offsets( i, j ) = table.index( i, j );
+                    } );
+                exec_space.fence();
+            };
+
+            /**
+             * Position of a Cell Along the Curve
+             **/
+            KOKKOS_INLINE_FUNCTION
+            long operator()( const long i, const long j ) const { return _offsets( i, j ); };
+
+          private:
+            offset_view _offsets; /**< Hilbert index of each cell */
+        };
+
+        /**
+ * Every Cell of an Index Space in Hilbert Order
+ * @param nx Cells along the first dimension
+ * @param ny Cells along the second dimension
+ * @return Indices of the cells in the order the curve visits them
+ */
+        inline std::vector<std::array<int, 2>> hilbertCells( const int nx, const int ny ) {
+            long                            side = coveringSide( nx, ny );
+            std::vector<std::array<int, 2>> cells;
+            cells.reserve( (long)nx * ny );
+
+            for ( long d = 0; d < side * side; d++ ) {
+                long x, y;
+                hilbertCoords( side, d, x, y );
+                if ( x < nx && y < ny ) cells.push_back( { (int)x, (int)y } );
+            }
+
+            return cells;
+        }
+
+    } // namespace SpaceFillingCurve
+} // namespace ExaCLAMR
+
+#endif
@@ -0,0 +1,105 @@
+/**
+ * @file
+ * @author Patrick Bridges <pbridges@unm.edu>
+ * @author Jered Dominguez-Trujillo <jereddt@unm.edu>
+ *
+ * @section DESCRIPTION
+ * Host copies of the state views for output and rebalancing
+ * Kokkos copies between memory spaces only when both views span contiguous storage, which the tiled layouts do not
+ * State in such a layout outside host memory is staged through a row-major view in its own memory space
+ */
+
+#ifndef EXACLAMR_STATEMIRROR_HPP
+#define EXACLAMR_STATEMIRROR_HPP
+
+// Include Statements
+#include <Kokkos_Core.hpp>
+
+#include <type_traits>
+
+namespace ExaCLAMR {
+
+    /**
+ * Whether a Layout Pads its Span Beyond the Extents of a View
+ * Specialized by each layout header to true for layouts that round extents up to whole tiles
+ */
+    template <class Layout>
+    struct LayoutPadded : std::false_type {};
+
+    namespace Impl {
+
+        /**
+         * Whether Copies of a View Between Memory Spaces Go Through a Row-Major View
+         **/
+        template <class View>
+        struct StateStaged : std::integral_constant<bool, LayoutPadded<typename View::array_layout>::value && !std::is_same<typename View::memory_space, Kokkos::HostSpace>::value> {};
+
+        /**
+         * Copy Every Element of a Rank-4 View Into Another of the Same Extents and Memory Space
+         **/
+        template <class Dst, class Src>
+        void stateCopy( const Dst &dst, const Src &src ) {
+            static_assert( int( Src::rank ) == 4, "State views are indexed by ( i, j, k, component )" );
+
+            using exec_space = typename Src::execution_space;
+
+            long n1 = src.extent( 1 ), n2 = src.extent( 2 ), n3 = src.extent( 3 );
+            long size = src.extent( 0 ) * n1 * n2;
+
+            Kokkos::parallel_for(
+                "State_Stage", Kokkos::RangePolicy<exec_space>( 0, size ), KOKKOS_LAMBDA( const long n ) {
+                    long i = n / ( n1 * n2 ), j = ( n / n2 ) % n1, k = n % n2;
+                    for ( long d = 0; d < n3; d++ ) dst( i, j, k, d ) = src( i, j, k, d );
+                } );
+            Kokkos::fence();
+        }
+
+        template <class View>
+        auto stateToHost( const View &view, std::false_type ) {
+            return Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(), view );
+        }
+
+        template <class View>
+        auto stateToHost( const View &view, std::true_type ) {
+            Kokkos::View<typename View::non_const_data_type, Kokkos::LayoutRight, typename View::memory_space> staged(
+                Kokkos::ViewAllocateWithoutInitializing( view.label() + "_staged" ), view.extent( 0 ), view.extent( 1 ), view.extent( 2 ), view.extent( 3 ) );
+            stateCopy( staged, view );
+            return Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(), staged );
+        }
+
+        template <class View, class HostView>
+        void stateFromHost( const View &view, const HostView &host, std::false_type ) {
+            Kokkos::deep_copy( view, host );
+        }
+
+        template <class View, class HostView>
+        void stateFromHost( const View &view, const HostView &host, std::true_type ) {
+            auto staged = Kokkos::create_mirror_view_and_copy( typename View::memory_space(), host );
+            stateCopy( view, staged );
+        }
+
+    } // namespace Impl
+
+    /**
+     * Host Copy of a State View
+     * @param view State view indexed by ( i, j, k, component )
+     * @return The view itself in host memory, otherwise a host view holding a copy of it
+     **/
+    template <class View>
+    auto stateToHost( const View &view ) {
+        return Impl::stateToHost( view, Impl::StateStaged<View>() );
+    }
+
+    /**
+     * Copy a Host Copy of a State View Back Into the View
+     * @param view State view indexed by ( i, j, k, component )
+     * @param host Host copy made by stateToHost
+     **/
+    template <class View, class HostView>
+    void stateFromHost( const View &view, const HostView &host ) {
+        Impl::stateFromHost( view, host, Impl::StateStaged<View>() );
+    }
+
+} // namespace ExaCLAMR
+
+#endif
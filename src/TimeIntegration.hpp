@@ -5,12 +5,18 @@
  * 
  * @section DESCRIPTION
  * Time Integration Step, include functions to:
- * Apply boundary conditions
- * Perform halo exchange
+ * Apply boundary conditions over the physical boundary strips
+ * Perform halo exchange, blocking or split into a start and a finish around the interior update
  * Calculate dynamic timestep based on wave speed
+ * Reduce diagnostics of the state on their own or fused into the integration step
  * Flux corrector calculation
  * Full time step calculation
  * Integration step using the shallow water equations
+ * Face-based integration step that computes each interface flux once
+ * Tiled integration step that computes each tile from a patch staged in team scratch memory
+ * Explicitly vectorized integration step for host execution spaces
+ * Cell kernels walk the cells in the problem manager's cell order, the storage order of curve and tiled layouts
+ * Face lists, time step, diagnostics, refinement flags and face-based integration step of an AMR mesh
  */
 
 #ifndef EXACLAMR_TIMEINTEGRATION_HPP
@@ -22,32 +28,159 @@
 
 // Include Statements
 #include <BoundaryConditions.hpp>
+#include <CellOrder.hpp>
+#include <Diagnostics.hpp>
 #include <ExaCLAMR.hpp>
+#include <LayoutTiled2D.hpp>
+#include <Neighbors.hpp>
 #include <ProblemManager.hpp>
+#include <Simd.hpp>
 
 #include <math.h>
 #include <stdio.h>
+#include <type_traits>
 
 namespace ExaCLAMR {
     namespace TimeIntegrator {
 
+        /**
+ * @struct KernelType
+ * @brief Struct which contains enums of the finite volume kernel options
+ */
+        struct KernelType {
+            enum Values {
+                CELL  = 0,
+                FACE  = 1,
+                TILED = 2,
+                SIMD  = 3
+            };
+        };
+
+        /**
+ * @struct TimeStepType
+ * @brief Struct which contains enums of the time step calculation options
+ */
+        struct TimeStepType {
+            enum Values {
+                SEPARATE = 0,
+                FUSED    = 1,
+                LAGGED   = 2
+            };
+        };
+
+/**
+ * Apply Boundary Conditions to the Current State
+ * Only the physical boundary strips owned by this rank are visited
+ *
+ * @param pm Problem manager
+ * @param exec_space Execution space
+ * @param bc Boundary policy ( BoundaryPolicy or runtime BoundaryCondition )
+ * @param depth Number of redundant ghost cells the boundaries extend along
+ * @param time_step Current time step
+**/
+        template <class ProblemManagerType, class ExecutionSpace, class BoundaryPolicyType>
+        void applyBoundaryConditions( const ProblemManagerType &pm, const ExecutionSpace &exec_space, const BoundaryPolicyType &bc, const int depth, const int time_step ) {
+            // Get Current State Views
+            auto u_current = pm.get( Location::Cell(), Field::Momentum(), CURRENTFIELD( time_step ) );
+            auto h_current = pm.get( Location::Cell(), Field::Height(), CURRENTFIELD( time_step ) );
+
+            // DEBUG: Print Boundary Condition Trace
+            if ( pm.mesh()->rank() == 0 && DEBUG ) std::cout << "Applying Boundary Conditions\n";
+
+            // Fill Boundary Strips
+            bc.apply( exec_space, *pm.mesh(), h_current, u_current, depth );
+        }
+
 /**
-* Perform Halo Exchange
+* Perform Halo Exchange and Fill the Physical Boundaries of the New State
 *
 * @param pm Problem manager
 * @param exec_space Execution space
-* @param mem_space Memory space
-* @param mindt Time increment/step (dt)
+* @param bc Boundary policy ( BoundaryPolicy or runtime BoundaryCondition )
+* @param depth Number of redundant ghost cells the boundaries extend along
 * @param time_step Current time step
 **/
-        template <typename state_t, class ProblemManagerType, class ExecutionSpace>
-        void haloExchange( const ProblemManagerType &pm, const ExecutionSpace &exec_space, const int time_step ) {
+        template <typename state_t, class ProblemManagerType, class ExecutionSpace, class BoundaryPolicyType>
+        void haloExchange( const ProblemManagerType &pm, const ExecutionSpace &exec_space, const BoundaryPolicyType &bc, const int depth, const int time_step ) {
             // DEBUG: Trace in Halo Exchange
             if ( pm.mesh()->rank() == 0 && DEBUG ) std::cout << "Starting Halo Exchange\n";
             if ( pm.mesh()->rank() == 0 && DEBUG ) std::cout << exec_space.name() << "\n";
 
             // Perform Halo Exchange on Height and Momentum State Views
             pm.gather( Location::Cell(), NEWFIELD( time_step ) );
+
+            // Boundary Cells of the New State are the Current State of the Next Time Step
+            applyBoundaryConditions( pm, exec_space, bc, depth, time_step + 1 );
+        }
+
+/**
+* Start a Halo Exchange of the New State Without Waiting for it
+* Ghost cells of the new state are not valid until haloExchangeFinish
+*
+* @param pm Problem manager
+* @param exec_space Execution space
+* @param time_step Current time step
+**/
+        template <class ProblemManagerType, class ExecutionSpace>
+        void haloExchangeStart( const ProblemManagerType &pm, const ExecutionSpace &exec_space, const int time_step ) {
+            // DEBUG: Trace in Halo Exchange
+            if ( pm.mesh()->rank() == 0 && DEBUG ) std::cout << "Starting Split Halo Exchange\n";
+
+            pm.gatherStart( Location::Cell(), NEWFIELD( time_step ) );
+        }
+
+/**
+* Finish a Halo Exchange Started by haloExchangeStart and Fill the Physical Boundaries of the New State
+*
+* @param pm Problem manager
+* @param exec_space Execution space
+* @param bc Boundary policy ( BoundaryPolicy or runtime BoundaryCondition )
+* @param depth Number of redundant ghost cells the boundaries extend along
+* @param time_step Time step the exchange was started on
+**/
+        template <class ProblemManagerType, class ExecutionSpace, class BoundaryPolicyType>
+        void haloExchangeFinish( const ProblemManagerType &pm, const ExecutionSpace &exec_space, const BoundaryPolicyType &bc, const int depth, const int time_step ) {
+            pm.gatherFinish( Location::Cell(), NEWFIELD( time_step ) );
+
+            // Boundary Cells of the New State are the Current State of the Next Time Step
+            applyBoundaryConditions( pm, exec_space, bc, depth, time_step + 1 );
+        }
+
+/**
+ * Whether a Cell Lies in an Index Space
+ * Redundant ghost cells updated between halo exchanges lie outside the domain and are left out of the diagnostics
+ *
+ * @param space Index space
+ * @param i Index in x-direction
+ * @param j Index in y-direction
+**/
+        KOKKOS_INLINE_FUNCTION
+        bool inSpace( const Cajita::IndexSpace<3> &space, const long i, const long j ) {
+            return i >= space.min( 0 ) && i < space.max( 0 ) && j >= space.min( 1 ) && j < space.max( 1 );
+        }
+
+/**
+ * Wave Speed Limited Time Step of a Single Cell
+ * 
+ * @param gravity Gravitational constant
+ * @param sigma Factor to control CFL number, stability and size of time step
+ * @param dx Cell size in x-direction
+ * @param dy Cell size in y-direction
+ * @param h Height
+ * @param u X-Momentum ( u )
+ * @param v Y-Momentum ( v )
+**/
+        template <typename state_t>
+        KOKKOS_INLINE_FUNCTION
+            state_t
+            cellTimeStep( state_t gravity, state_t sigma, state_t dx, state_t dy, state_t h, state_t u, state_t v ) {
+            // Wave Speed Calculation
+            state_t wavespeed = sqrt( gravity * h );
+            state_t xspeed    = ( fabs( u + wavespeed ) ) / dx;
+            state_t yspeed    = ( fabs( v + wavespeed ) ) / dy;
+
+            // Time Step Calculation
+            return sigma / ( xspeed + yspeed );
         }
 
 /**
@@ -77,18 +210,13 @@ namespace ExaCLAMR {
             state_t dt_min;
 
             // Kokkos Parallel Reduce of Domain Index Space to Calculate Time Step ( i, j, k )
-            Kokkos::parallel_reduce(
-                "Set_TimeStep", Cajita::createExecutionPolicy( domain, exec_space ), KOKKOS_LAMBDA( const int i, const int j, const int k, state_t &lmin ) {
-                    // Wave Speed Calculation
-                    state_t wavespeed = sqrt( gravity * h_current( i, j, k, 0 ) );
-                    state_t xspeed    = ( fabs( u_current( i, j, k, 0 ) + wavespeed ) ) / dx;
-                    state_t yspeed    = ( fabs( u_current( i, j, k, 1 ) + wavespeed ) ) / dy;
-
+            cellReduce(
+                "Set_TimeStep", pm.order(), domain, exec_space, KOKKOS_LAMBDA( const int i, const int j, const int k, state_t &lmin ) {
                     // Time Step Calculation
-                    state_t dt = sigma / ( xspeed + yspeed );
+                    state_t dt = cellTimeStep<state_t>( gravity, sigma, dx, dy, h_current( i, j, k, 0 ), u_current( i, j, k, 0 ), u_current( i, j, k, 1 ) );
 
-                    // DEBUG: Print Wave Speed, X Speed, Y Speed, and Time Step Calculated for Current Index ( i, j, k )
-                    // if ( DEBUG ) std::cout << "'Wavespeed: " << wavespeed << "\txspeed: " << xspeed << "\tyspeed: " << yspeed << "\tdeltaT: " << dt << "\n";
+                    // DEBUG: Print Time Step Calculated for Current Index ( i, j, k )
+                    // if ( DEBUG ) std::cout << "deltaT: " << dt << "\n";
 
                     // Set Minimum
                     if ( dt < lmin ) lmin = dt;
@@ -101,6 +229,45 @@ namespace ExaCLAMR {
             return dt_min;
         }
 
+/**
+* Reduce diagnostics of the current state in a pass of their own
+*
+* @param pm Problem manager
+* @param exec_space Execution space
+* @param gravity Gravitational constant
+* @param sigma Factor to control CFL number, stability and size of time step
+* @param diagnostics Mask of diagnostics to reduce
+* @param time_step Current time step
+* @return Local diagnostics of the current state
+**/
+        template <class ProblemManagerType, class ExecutionSpace, typename state_t>
+        DiagnosticValues<state_t> reduceDiagnostics( const ProblemManagerType &pm, const ExecutionSpace &exec_space, const state_t gravity, const state_t sigma, const int diagnostics, const int time_step ) {
+            // Get dx and dy of Regular Mesh Cell
+            state_t dx = pm.mesh()->cellSize( 0 );
+            state_t dy = pm.mesh()->cellSize( 1 );
+
+            // Get Current State Variables
+            auto h_current = pm.get( Location::Cell(), Field::Height(), CURRENTFIELD( time_step ) );
+            auto u_current = pm.get( Location::Cell(), Field::Momentum(), CURRENTFIELD( time_step ) );
+
+            // Get Domain Index Space to Loop Over
+            auto domain = pm.mesh()->domainSpace();
+
+            DiagnosticValues<state_t> local_diagnostics;
+
+            // Kokkos Parallel Reduce of Domain Index Space to Calculate Diagnostics ( i, j, k )
+            cellReduce(
+                "Diagnostics", pm.order(), domain, exec_space, KOKKOS_LAMBDA( const int i, const int j, const int k, DiagnosticValues<state_t> &lval ) {
+                    state_t h = h_current( i, j, k, 0 );
+                    state_t u = u_current( i, j, k, 0 );
+                    state_t v = u_current( i, j, k, 1 );
+                    diagnosticsAccumulate( lval, diagnostics, cellTimeStep( gravity, sigma, dx, dy, h, u, v ), h, u, v );
+                },
+                DiagnosticsReducer<state_t, Kokkos::HostSpace>( local_diagnostics ) );
+
+            return local_diagnostics;
+        }
+
 /**
  * Flux for Uy and Vx directions
  * 
@@ -171,19 +338,207 @@ namespace ExaCLAMR {
             return ( u + ( -( dt / dr ) * ( ( f_plus - f_minus ) + ( g_plus - g_minus ) ) ) );
         }
 
+/**
+ * Lax-Wendroff Flux and TVD Flux Corrector Across a Single Face
+ * Stencil values are ordered left2, left, right, right2 along the face normal
+ * 
+ * @param dt Time step
+ * @param dr Spatial step normal to the face (dx or dy)
+ * @param gravity Gravitational constant
+ * @param ghalf Half of the gravitational constant
+ * @param h Height stencil
+ * @param un Normal momentum stencil
+ * @param ut Tangential momentum stencil
+ * @param flux Height flux, normal momentum flux, tangential momentum flux, height corrector, normal momentum corrector
+**/
+        template <typename state_t>
+        KOKKOS_INLINE_FUNCTION void faceFlux( state_t dt, state_t dr, state_t gravity, state_t ghalf, const state_t h[4], const state_t un[4], const state_t ut[4], state_t flux[5] ) {
+            // Half Step Values at the Face
+            state_t h_half  = 0.5 * ( ( h[1] + h[2] ) - ( dt ) / ( dr ) * ( ( un[2] ) - ( un[1] ) ) );
+            state_t un_half = 0.5 * ( ( un[1] + un[2] ) - ( dt ) / ( dr ) * ( ( fluxUxVy( un[2], h[2], ghalf ) ) - ( fluxUxVy( un[1], h[1], ghalf ) ) ) );
+            state_t ut_half = 0.5 * ( ( ut[1] + ut[2] ) - ( dt ) / ( dr ) * ( ( fluxUyVx( un[2], ut[2], h[2] ) ) - ( fluxUyVx( un[1], ut[1], h[1] ) ) ) );
+
+            // Fluxes
+            flux[0] = un_half;
+            flux[1] = ( POW2( un_half ) / h_half + ghalf * POW2( h_half ) );
+            flux[2] = ( un_half * ut_half / h_half );
+
+            // Flux Correctors
+            state_t eigen = fabs( un_half / h_half ) + sqrt( gravity * h_half );
+
+            flux[3] = wCorrector( dt, dr, eigen, h[2] - h[1], h[1] - h[0], h[3] - h[2] );
+            flux[3] *= h[2] - h[1];
+
+            flux[4] = wCorrector( dt, dr, eigen, un[2] - un[1], un[1] - un[0], un[3] - un[2] );
+            flux[4] *= un[2] - un[1];
+        }
+
+/**
+ * Lax-Wendroff Update with TVD Flux Correctors of a Single Cell from its Stencil
+ * Stencil values are ordered minus2, minus1, center, plus1, plus2 along each direction
+ * 
+ * @param dt Time step
+ * @param dx Cell size in x-direction
+ * @param dy Cell size in y-direction
+ * @param gravity Gravitational constant
+ * @param ghalf Half of the gravitational constant
+ * @param h_x Height stencil in x-direction
+ * @param h_y Height stencil in y-direction
+ * @param u_x X-Momentum stencil in x-direction
+ * @param u_y X-Momentum stencil in y-direction
+ * @param v_x Y-Momentum stencil in x-direction
+ * @param v_y Y-Momentum stencil in y-direction
+ * @param state New height, x-momentum and y-momentum of the cell
+**/
+        template <typename state_t>
+        KOKKOS_INLINE_FUNCTION void cellUpdate( state_t dt, state_t dx, state_t dy, state_t gravity, state_t ghalf, const state_t h_x[5], const state_t h_y[5], const state_t u_x[5], const state_t u_y[5], const state_t v_x[5], const state_t v_y[5], state_t state[3] ) {
+            state_t h_ic     = h_x[2];
+            state_t h_left   = h_x[1];
+            state_t h_right  = h_x[3];
+            state_t h_bot    = h_y[1];
+            state_t h_top    = h_y[3];
+            state_t h_left2  = h_x[0];
+            state_t h_right2 = h_x[4];
+            state_t h_bot2   = h_y[0];
+            state_t h_top2   = h_y[4];
+
+            state_t u_ic     = u_x[2];
+            state_t u_left   = u_x[1];
+            state_t u_right  = u_x[3];
+            state_t u_bot    = u_y[1];
+            state_t u_top    = u_y[3];
+            state_t u_left2  = u_x[0];
+            state_t u_right2 = u_x[4];
+
+            state_t v_ic    = v_x[2];
+            state_t v_left  = v_x[1];
+            state_t v_right = v_x[3];
+            state_t v_bot   = v_y[1];
+            state_t v_top   = v_y[3];
+            state_t v_bot2  = v_y[0];
+            state_t v_top2  = v_y[4];
+
+            // Shallow Water Equations
+            // X Minus Direction
+            state_t hx_minus = 0.5 * ( ( h_left + h_ic ) - ( dt ) / ( dx ) * ( ( u_ic ) - ( u_left ) ) );
+            state_t ux_minus = 0.5 * ( ( u_left + u_ic ) - ( dt ) / ( dx ) * ( ( fluxUxVy( u_ic, h_ic, ghalf ) ) - ( fluxUxVy( u_left, h_left, ghalf ) ) ) );
+            state_t vx_minus = 0.5 * ( ( v_left + v_ic ) - ( dt ) / ( dx ) * ( ( fluxUyVx( u_ic, v_ic, h_ic ) ) - ( fluxUyVx( u_left, v_left, h_left ) ) ) );
+
+            // DEBUG: Print hx_minus, ux_minus, vx_minus, i, j, k
+            // if ( DEBUG ) std::cout << std::left << std::setw( 10 ) << "hx_minus: " << std::setw( 6 ) << hx_minus << \
+            "\tux_minus: " << std::setw( 6 ) << ux_minus << "\tvx_minus: " << std::setw( 6 ) << vx_minus << "\ti: " << i << "\tj: "<< j << "\tk: " << k << "\n";
+
+            // X Plus Direction
+            state_t hx_plus = 0.5 * ( ( h_ic + h_right ) - ( dt ) / ( dx ) * ( ( u_right ) - ( u_ic ) ) );
+            state_t ux_plus = 0.5 * ( ( u_ic + u_right ) - ( dt ) / ( dx ) * ( ( fluxUxVy( u_right, h_right, ghalf ) ) - ( fluxUxVy( u_ic, h_ic, ghalf ) ) ) );
+            state_t vx_plus = 0.5 * ( ( v_ic + v_right ) - ( dt ) / ( dx ) * ( ( fluxUyVx( u_right, v_right, h_right ) ) - ( fluxUyVx( u_ic, v_ic, h_ic ) ) ) );
+
+            // DEBUG: Print hx_plus, ux_plus, vx_plus, i, j, k
+            // if ( DEBUG ) std::cout << std::left << std::setw( 10 ) << "hx_plus: " << std::setw( 6 ) << hx_plus << \
+            "\tux_plus: " << std::setw( 6 ) << ux_plus << "\tvx_plus: " << std::setw( 6 ) << vx_plus << "\ti: " << i << "\tj: " << j << "\tk: " << k << "\n";
+
+            // Y Minus Direction
+            state_t hy_minus = 0.5 * ( ( h_bot + h_ic ) - ( dt ) / ( dy ) * ( ( v_ic ) - ( v_bot ) ) );
+            state_t uy_minus = 0.5 * ( ( u_bot + u_ic ) - ( dt ) / ( dy ) * ( ( fluxUyVx( u_ic, v_ic, h_ic ) ) - ( fluxUyVx( u_bot, v_bot, h_bot ) ) ) );
+            state_t vy_minus = 0.5 * ( ( v_bot + v_ic ) - ( dt ) / ( dy ) * ( ( fluxUxVy( v_ic, h_ic, ghalf ) ) - ( fluxUxVy( v_bot, h_bot, ghalf ) ) ) );
+
+            // DEBUG: Print hy_minus, uy_minus, vy_minus, i, j, k
+            // if ( DEBUG ) std::cout << std::left << std::setw( 10 ) << "hy_minus: " << std::setw( 6 ) << hy_minus << \
+            "\tuy_minus: " << std::setw( 6 ) << uy_minus << "\tvy_minus: " << std::setw( 6 ) << vy_minus << "\ti: " << i << "\tj: " << j << "\tk: " << k << "\n";
+
+            // Y Plus Direction
+            state_t hy_plus = 0.5 * ( ( h_ic + h_top ) - ( dt ) / ( dy ) * ( ( v_top ) - ( v_ic ) ) );
+            state_t uy_plus = 0.5 * ( ( u_ic + u_top ) - ( dt ) / ( dy ) * ( ( fluxUyVx( u_top, v_top, h_top ) ) - ( fluxUyVx( u_ic, v_ic, h_ic ) ) ) );
+            state_t vy_plus = 0.5 * ( ( v_ic + v_top ) - ( dt ) / ( dy ) * ( ( fluxUxVy( v_top, h_top, ghalf ) ) - ( fluxUxVy( v_ic, h_ic, ghalf ) ) ) );
+
+            // DEBUG: Print hy_plus, uy_plus, vy_plus, i, j, k
+            // if ( DEBUG ) std::cout << std::left << std::setw( 10 ) << "hy_plus: " << std::setw( 6 ) << hy_plus << \
+            "\tuy_plus: " << std::setw( 6 ) << uy_plus << "\tvy_plus: " << std::setw( 6 ) << vy_plus << "\ti: " << i << "\tj: " << j << "\tk: " << k << "\n";
+
+            // Flux Updates
+            // X Direction
+            state_t hx_flux_minus    = ux_minus;
+            state_t ux_flux_minus[2] = { ( POW2( ux_minus ) / hx_minus + ghalf * POW2( hx_minus ) ), ux_minus * vx_minus / hx_minus };
+
+            state_t hx_flux_plus    = ux_plus;
+            state_t ux_flux_plus[2] = { ( POW2( ux_plus ) / hx_plus + ghalf * POW2( hx_plus ) ), ( ux_plus * vx_plus / hx_plus ) };
+
+            // Y Direction
+            state_t hy_flux_minus    = vy_minus;
+            state_t uy_flux_minus[2] = { ( vy_minus * uy_minus / hy_minus ), ( POW2( vy_minus ) / hy_minus + ghalf * POW2( hy_minus ) ) };
+
+            state_t hy_flux_plus    = vy_plus;
+            state_t uy_flux_plus[2] = { ( vy_plus * uy_plus / hy_plus ), ( POW2( vy_plus ) / hy_plus + ghalf * POW2( hy_plus ) ) };
+
+            // DEBUG: Print hx_flux_minus, hx_flux_plus, hy_flux_minus, hy_flux_plus, i, j, k
+            // if ( DEBUG ) std::cout << std::left << std::setw( 10 ) << "hx_flux_minus: " << std::setw( 6 ) << hx_flux_minus << "\thx_flux_plus: " << std::setw( 6 ) << hx_flux_plus << \
+            "\thy_flux_minus: " << std::setw( 6 ) << hy_flux_minus << "\thy_flux_plus: " << std::setw( 6 ) << hy_flux_plus << "\ti: " << i << "\tj: " << j << "\tk: " << k << "\n";
+
+            // Flux Corrector Calculations
+            // Wave Speeds at the Minus and Plus Half Steps
+            state_t x_eigen_minus = fabs( ux_minus / hx_minus ) + sqrt( gravity * hx_minus );
+            state_t x_eigen_plus  = fabs( ux_plus / hx_plus ) + sqrt( gravity * hx_plus );
+            state_t y_eigen_minus = fabs( vy_minus / hy_minus ) + sqrt( gravity * hy_minus );
+            state_t y_eigen_plus  = fabs( vy_plus / hy_plus ) + sqrt( gravity * hy_plus );
+
+            // X Direction
+            state_t hx_w_minus = wCorrector( dt, dx, x_eigen_minus, h_ic - h_left, h_left - h_left2, h_right - h_ic );
+            hx_w_minus *= h_ic - h_left;
+
+            state_t hx_w_plus = wCorrector( dt, dx, x_eigen_plus, h_right - h_ic, h_ic - h_left, h_right2 - h_right );
+            hx_w_plus *= h_right - h_ic;
+
+            state_t u_w_minus[2], u_w_plus[2];
+
+            u_w_minus[0] = wCorrector( dt, dx, x_eigen_minus, u_ic - u_left, u_left - u_left2, u_right - u_ic );
+            u_w_minus[0] *= u_ic - u_left;
+
+            u_w_plus[0] = wCorrector( dt, dx, x_eigen_plus, u_right - u_ic, u_ic - u_left, u_right2 - u_right );
+            u_w_plus[0] *= u_right - u_ic;
+
+            // Y Direction
+            state_t hy_w_minus = wCorrector( dt, dy, y_eigen_minus, h_ic - h_bot, h_bot - h_bot2, h_top - h_ic );
+            hy_w_minus *= h_ic - h_bot;
+
+            state_t hy_w_plus = wCorrector( dt, dy, y_eigen_plus, h_top - h_ic, h_ic - h_bot, h_top2 - h_top );
+            hy_w_plus *= h_top - h_ic;
+
+            u_w_minus[1] = wCorrector( dt, dy, y_eigen_minus, v_ic - v_bot, v_bot - v_bot2, v_top - v_ic );
+            u_w_minus[1] *= v_ic - v_bot;
+
+            u_w_plus[1] = wCorrector( dt, dy, y_eigen_plus, v_top - v_ic, v_ic - v_bot, v_top2 - v_top );
+            u_w_plus[1] *= v_top - v_ic;
+
+            // DEBUG: Print hx_w_minus, hx_w_plus, hy_w_minus, hy_w_plus, i, j, k
+            // if ( DEBUG ) std::cout << std::left << std::setw( 10 ) << "hx_w_minus: " << std::setw( 6 ) << hx_w_minus << "\thx_w_plus: " << std::setw( 6 ) << hx_w_plus << \
+            "\thy_w_minus: " << std::setw( 6 ) << hy_w_minus << "\thy_w_plus: " << std::setw( 6 ) << hy_w_plus << "\ti: " << i << "\tj: " << j << "\tk: " << k << "\n";
+
+            // Full Step Update
+            state_t h_full = uFullStep( dt, dx, h_ic, hx_flux_plus, hx_flux_minus, hy_flux_plus, hy_flux_minus ) - hx_w_minus + hx_w_plus - hy_w_minus + hy_w_plus;
+            state_t u_full = uFullStep( dt, dx, u_ic, ux_flux_plus[0], ux_flux_minus[0], uy_flux_plus[0], uy_flux_minus[0] ) - u_w_minus[0] + u_w_plus[0];
+            state_t v_full = uFullStep( dt, dy, v_ic, ux_flux_plus[1], ux_flux_minus[1], uy_flux_plus[1], uy_flux_minus[1] ) - u_w_minus[1] + u_w_plus[1];
+
+            state[0] = h_full;
+            state[1] = u_full;
+            state[2] = v_full;
+        }
+
 /**
  * Time Step Iteration of Shallow Water Equations
  * 
  * @param pm Problem manager
  * @param exec_space Execution space
  * @param mem_space Memory space
- * @param bc Boundary conditions
  * @param dt Time step (dt)
  * @param gravity Gravitational constant
+ * @param sigma Factor to control CFL number, stability and size of time step
+ * @param diagnostics Mask of diagnostics to reduce from the new state values
+ * @param domain Cells to update: the domain, the domain and redundant ghost cells around it, or part of either
  * @param time_step Current time step (count) 
+ * @return Local diagnostics of the new state
 **/
         template <class ProblemManagerType, class ExecutionSpace, typename state_t>
-        void step( const ProblemManagerType &pm, const ExecutionSpace &exec_space, const ExaCLAMR::BoundaryCondition &bc, const state_t dt, const state_t gravity, const int time_step ) {
+        DiagnosticValues<state_t> step( const ProblemManagerType &pm, const ExecutionSpace &exec_space, const state_t dt, const state_t gravity, const state_t sigma, const int diagnostics, const Cajita::IndexSpace<3> &domain, const int time_step ) {
             if ( pm.mesh()->rank() == 0 && DEBUG ) std::cout << "Time Stepper\n";
 
             // Get dx and dy
@@ -191,217 +546,799 @@ namespace ExaCLAMR {
             state_t dy    = pm.mesh()->cellSize( 1 );
             state_t ghalf = 0.5 * gravity;
 
-            // Get Local Grid to get Owned Index Space
-            auto local_grid  = pm.mesh()->localGrid();
-            auto owned_cells = local_grid->indexSpace( Cajita::Own(), Cajita::Cell(), Cajita::Local() );
-
-            // Get Domain Index Space to Check Boundaries
-            auto mesh = *pm.mesh();
-
             // Get Current State Views
             auto u_current = pm.get( Location::Cell(), Field::Momentum(), CURRENTFIELD( time_step ) );
             auto h_current = pm.get( Location::Cell(), Field::Height(), CURRENTFIELD( time_step ) );
 
-            // Apply Boundary Conditions
-            // DEBUG: Print Boundary Condition Trace
-            if ( pm.mesh()->rank() == 0 && DEBUG ) std::cout << "Applying Boundary Conditions\n";
-            // Loop Over All Owned Cells and Update Boundary Cells ( i, j, k )
-            Kokkos::parallel_for(
-                "Boundary_Conditions", Cajita::createExecutionPolicy( owned_cells, exec_space ), KOKKOS_LAMBDA( const int i, const int j, const int k ) {
-                    bc( pm, i, j, k, h_current, u_current, mesh );
-                } );
-
-            // Kokkos Fence
-            Kokkos::fence();
-
             // Get New State Views
             auto u_new = pm.get( Location::Cell(), Field::Momentum(), NEWFIELD( time_step ) );
             auto h_new = pm.get( Location::Cell(), Field::Height(), NEWFIELD( time_step ) );
 
-            // Get Flux Views
-            auto hx_flux_plus  = pm.get( Location::Cell(), Field::HxFluxPlus() );
-            auto hx_flux_minus = pm.get( Location::Cell(), Field::HxFluxMinus() );
-            auto ux_flux_plus  = pm.get( Location::Cell(), Field::UxFluxPlus() );
-            auto ux_flux_minus = pm.get( Location::Cell(), Field::UxFluxMinus() );
+            // Precision the State is Stored in
+            typedef typename decltype( h_new )::non_const_value_type storage_t;
 
-            auto hy_flux_plus  = pm.get( Location::Cell(), Field::HyFluxPlus() );
-            auto hy_flux_minus = pm.get( Location::Cell(), Field::HyFluxMinus() );
-            auto uy_flux_plus  = pm.get( Location::Cell(), Field::UyFluxPlus() );
-            auto uy_flux_minus = pm.get( Location::Cell(), Field::UyFluxMinus() );
-
-            // Get Flux Corrector Views
-            auto hx_w_plus  = pm.get( Location::Cell(), Field::HxWPlus() );
-            auto hx_w_minus = pm.get( Location::Cell(), Field::HxWMinus() );
-            auto hy_w_plus  = pm.get( Location::Cell(), Field::HyWPlus() );
-            auto hy_w_minus = pm.get( Location::Cell(), Field::HyWMinus() );
-
-            auto u_w_plus  = pm.get( Location::Cell(), Field::UWPlus() );
-            auto u_w_minus = pm.get( Location::Cell(), Field::UWMinus() );
-
-            auto domain = pm.mesh()->domainSpace();
+            // Only Cells of the Domain Itself Contribute to Diagnostics - Redundant Ghost Cells are Left Out
+            auto owned = pm.mesh()->domainSpace();
 
             // DEBUG: Print out Domain Space Indices
             if ( DEBUG ) std::cout << "Domain Space: " << domain.min( 0 ) << domain.min( 1 ) << domain.min( 2 ) << domain.max( 0 ) << domain.max( 1 ) << domain.max( 2 ) << "\n";
 
+            // Diagnostics of the New State
+            DiagnosticValues<state_t> local_diagnostics;
+
             // Kokkos Parallel Section over Domain Space Indices to Calculate New State Values ( i, j, k )
-            Kokkos::parallel_for(
-                "Finite_Volume", Cajita::createExecutionPolicy( domain, exec_space ), KOKKOS_LAMBDA( const int i, const int j, const int k ) {
+            // Fluxes and Flux Correctors are Kept in Registers - Only the State Views are Read and Written
+            cellReduce(
+                "Finite_Volume", pm.order(), domain, exec_space, KOKKOS_LAMBDA( const int i, const int j, const int k, DiagnosticValues<state_t> &lval ) {
                     // Simple Diffusion Problem
                     // h_new( i, j, k, 0 ) = ( h_current( i - 1, j, k, 0 ) + h_current( i + 1, j, k, 0 ) + h_current( i, j - 1, k, 0 ) + h_current( i, j + 1, k, 0 ) ) / 4;
 
                     // Store Current Iteration Values Locally to Speed Up Performance and Reduce Fetches and Cache Misses
-                    state_t h_ic     = h_current( i, j, k, 0 );
-                    state_t h_left   = h_current( i - 1, j, k, 0 );
-                    state_t h_right  = h_current( i + 1, j, k, 0 );
-                    state_t h_bot    = h_current( i, j - 1, k, 0 );
-                    state_t h_top    = h_current( i, j + 1, k, 0 );
-                    state_t h_left2  = h_current( i - 2, j, k, 0 );
-                    state_t h_right2 = h_current( i + 2, j, k, 0 );
-                    state_t h_bot2   = h_current( i, j - 2, k, 0 );
-                    state_t h_top2   = h_current( i, j + 2, k, 0 );
-
-                    state_t u_ic     = u_current( i, j, k, 0 );
-                    state_t u_left   = u_current( i - 1, j, k, 0 );
-                    state_t u_right  = u_current( i + 1, j, k, 0 );
-                    state_t u_bot    = u_current( i, j - 1, k, 0 );
-                    state_t u_top    = u_current( i, j + 1, k, 0 );
-                    state_t u_left2  = u_current( i - 2, j, k, 0 );
-                    state_t u_right2 = u_current( i + 2, j, k, 0 );
-                    state_t u_bot2   = u_current( i, j - 2, k, 0 );
-                    state_t u_top2   = u_current( i, j + 2, k, 0 );
-
-                    state_t v_ic     = u_current( i, j, k, 1 );
-                    state_t v_left   = u_current( i - 1, j, k, 1 );
-                    state_t v_right  = u_current( i + 1, j, k, 1 );
-                    state_t v_bot    = u_current( i, j - 1, k, 1 );
-                    state_t v_top    = u_current( i, j + 1, k, 1 );
-                    state_t v_left2  = u_current( i - 2, j, k, 1 );
-                    state_t v_right2 = u_current( i + 2, j, k, 1 );
-                    state_t v_bot2   = u_current( i, j - 2, k, 1 );
-                    state_t v_top2   = u_current( i, j + 2, k, 1 );
+                    state_t h_x[5] = { h_current( i - 2, j, k, 0 ), h_current( i - 1, j, k, 0 ), h_current( i, j, k, 0 ), h_current( i + 1, j, k, 0 ), h_current( i + 2, j, k, 0 ) };
+                    state_t h_y[5] = { h_current( i, j - 2, k, 0 ), h_current( i, j - 1, k, 0 ), h_current( i, j, k, 0 ), h_current( i, j + 1, k, 0 ), h_current( i, j + 2, k, 0 ) };
+                    state_t u_x[5] = { u_current( i - 2, j, k, 0 ), u_current( i - 1, j, k, 0 ), u_current( i, j, k, 0 ), u_current( i + 1, j, k, 0 ), u_current( i + 2, j, k, 0 ) };
+                    state_t u_y[5] = { u_current( i, j - 2, k, 0 ), u_current( i, j - 1, k, 0 ), u_current( i, j, k, 0 ), u_current( i, j + 1, k, 0 ), u_current( i, j + 2, k, 0 ) };
+                    state_t v_x[5] = { u_current( i - 2, j, k, 1 ), u_current( i - 1, j, k, 1 ), u_current( i, j, k, 1 ), u_current( i + 1, j, k, 1 ), u_current( i + 2, j, k, 1 ) };
+                    state_t v_y[5] = { u_current( i, j - 2, k, 1 ), u_current( i, j - 1, k, 1 ), u_current( i, j, k, 1 ), u_current( i, j + 1, k, 1 ), u_current( i, j + 2, k, 1 ) };
 
                     // Shallow Water Equations
-                    // X Minus Direction
-                    state_t hx_minus = 0.5 * ( ( h_left + h_ic ) - ( dt ) / ( dx ) * ( ( u_ic ) - ( u_left ) ) );
-                    state_t ux_minus = 0.5 * ( ( u_left + u_ic ) - ( dt ) / ( dx ) * ( ( fluxUxVy( u_ic, h_ic, ghalf ) ) - ( fluxUxVy( u_left, h_left, ghalf ) ) ) );
-                    state_t vx_minus = 0.5 * ( ( v_left + v_ic ) - ( dt ) / ( dx ) * ( ( fluxUyVx( u_ic, v_ic, h_ic ) ) - ( fluxUyVx( u_left, v_left, h_left ) ) ) );
-
-                    // DEBUG: Print hx_minus, ux_minus, vx_minus, i, j, k
-                    // if ( DEBUG ) std::cout << std::left << std::setw( 10 ) << "hx_minus: " << std::setw( 6 ) << hx_minus << \
-                    "\tux_minus: " << std::setw( 6 ) << ux_minus << "\tvx_minus: " << std::setw( 6 ) << vx_minus << "\ti: " << i << "\tj: "<< j << "\tk: " << k << "\n";
-
-                    // X Plus Direction
-                    state_t hx_plus = 0.5 * ( ( h_ic + h_right ) - ( dt ) / ( dx ) * ( ( u_right ) - ( u_ic ) ) );
-                    state_t ux_plus = 0.5 * ( ( u_ic + u_right ) - ( dt ) / ( dx ) * ( ( fluxUxVy( u_right, h_right, ghalf ) ) - ( fluxUxVy( u_ic, h_ic, ghalf ) ) ) );
-                    state_t vx_plus = 0.5 * ( ( v_ic + v_right ) - ( dt ) / ( dx ) * ( ( fluxUyVx( u_right, v_right, h_right ) ) - ( fluxUyVx( u_ic, v_ic, h_ic ) ) ) );
-
-                    // DEBUG: Print hx_plus, ux_plus, vx_plus, i, j, k
-                    // if ( DEBUG ) std::cout << std::left << std::setw( 10 ) << "hx_plus: " << std::setw( 6 ) << hx_plus << \
-                    "\tux_plus: " << std::setw( 6 ) << ux_plus << "\tvx_plus: " << std::setw( 6 ) << vx_plus << "\ti: " << i << "\tj: " << j << "\tk: " << k << "\n";
-
-                    // Y Minus Direction
-                    state_t hy_minus = 0.5 * ( ( h_bot + h_ic ) - ( dt ) / ( dy ) * ( ( v_ic ) - ( v_bot ) ) );
-                    state_t uy_minus = 0.5 * ( ( u_bot + u_ic ) - ( dt ) / ( dy ) * ( ( fluxUyVx( u_ic, v_ic, h_ic ) ) - ( fluxUyVx( u_bot, v_bot, h_bot ) ) ) );
-                    state_t vy_minus = 0.5 * ( ( v_bot + v_ic ) - ( dt ) / ( dy ) * ( ( fluxUxVy( v_ic, h_ic, ghalf ) ) - ( fluxUxVy( v_bot, h_bot, ghalf ) ) ) );
-
-                    // DEBUG: Print hy_minus, uy_minus, vy_minus, i, j, k
-                    // if ( DEBUG ) std::cout << std::left << std::setw( 10 ) << "hy_minus: " << std::setw( 6 ) << hy_minus << \
-                    "\tuy_minus: " << std::setw( 6 ) << uy_minus << "\tvy_minus: " << std::setw( 6 ) << vy_minus << "\ti: " << i << "\tj: " << j << "\tk: " << k << "\n";
-
-                    // Y Plus Direction
-                    state_t hy_plus = 0.5 * ( ( h_ic + h_top ) - ( dt ) / ( dy ) * ( ( v_top ) - ( v_ic ) ) );
-                    state_t uy_plus = 0.5 * ( ( u_ic + u_top ) - ( dt ) / ( dy ) * ( ( fluxUyVx( u_top, v_top, h_top ) ) - ( fluxUyVx( u_ic, v_ic, h_ic ) ) ) );
-                    state_t vy_plus = 0.5 * ( ( v_ic + v_top ) - ( dt ) / ( dy ) * ( ( fluxUxVy( v_top, h_top, ghalf ) ) - ( fluxUxVy( v_ic, h_ic, ghalf ) ) ) );
-
-                    // DEBUG: Print hy_plus, uy_plus, vy_plus, i, j, k
-                    // if ( DEBUG ) std::cout << std::left << std::setw( 10 ) << "hy_plus: " << std::setw( 6 ) << hy_plus << \
-                    "\tuy_plus: " << std::setw( 6 ) << uy_plus << "\tvy_plus: " << std::setw( 6 ) << vy_plus << "\ti: " << i << "\tj: " << j << "\tk: " << k << "\n";
-
-                    // Flux View Updates
-                    // X Direction
-                    hx_flux_minus( i, j, k, 0 ) = ux_minus;
-                    ux_flux_minus( i, j, k, 0 ) = ( POW2( ux_minus ) / hx_minus + ghalf * POW2( hx_minus ) );
-                    ux_flux_minus( i, j, k, 1 ) = ux_minus * vx_minus / hx_minus;
-
-                    // DEBUG: Print hx_flux_minus, ux_flux_minus, ux_flux_minus, i, j, k
-                    // if ( DEBUG ) std::cout << std::left << std::setw( 10 ) << "hx_flux_minus: " << std::setw( 6 ) << hx_flux_minus( i, j, k, 0 ) << \
-                    "\tux_flux_minus: " << std::setw( 6 ) << ux_flux_minus( i, j, k, 0 ) << "\tux_flux_minus: " << std::setw( 6 ) << ux_flux_minus( i, j, k, 1 ) << \
-                    "\ti: " << i << "\tj: " << j << "\tk: " << k << "\n";
-
-                    hx_flux_plus( i, j, k, 0 ) = ux_plus;
-                    ux_flux_plus( i, j, k, 0 ) = ( POW2( ux_plus ) / hx_plus + ghalf * POW2( hx_plus ) );
-                    ux_flux_plus( i, j, k, 1 ) = ( ux_plus * vx_plus / hx_plus );
-
-                    // DEBUG: Print hx_flux_plus, ux_flux_plus, ux_flux_plus, i, j, k
-                    // if ( DEBUG ) std::cout << std::left << std::setw( 10 ) << "hx_flux_plus: " << std::setw( 6 ) << hx_flux_plus( i, j, k, 0 ) << \
-                    "\tux_flux_plus: " << std::setw( 6 ) << ux_flux_plus( i, j, k, 0 ) << "\tux_flux_plus: " << std::setw( 6 ) << ux_flux_plus( i, j, k, 1 ) << \
-                    "\ti: " << i << "\tj: " << j << "\tk: " << k << "\n";
-
-                    // Y Direction
-                    hy_flux_minus( i, j, k, 0 ) = vy_minus;
-                    uy_flux_minus( i, j, k, 0 ) = ( vy_minus * uy_minus / hy_minus );
-                    uy_flux_minus( i, j, k, 1 ) = ( POW2( vy_minus ) / hy_minus + ghalf * POW2( hy_minus ) );
-
-                    // DEBUG: Print hy_flux_minus, uy_flux_minus, uy_flux_minus, i, j, k
-                    // if ( DEBUG ) std::cout << std::left << std::setw( 10 ) << "hy_flux_minus: " << std::setw( 6 ) << hy_flux_minus( i, j, k, 0 ) << \
-                    "\tuy_flux_minus: " << std::setw( 6 ) << uy_flux_minus( i, j, k, 0 ) << "\tuy_flux_minus: " << std::setw( 6 ) << uy_flux_minus( i, j, k, 1 ) << \
-                    "\ti: " << i << "\tj: " << j << "\tk: " << k << "\n";
-
-                    hy_flux_plus( i, j, k, 0 ) = vy_plus;
-                    uy_flux_plus( i, j, k, 0 ) = ( vy_plus * uy_plus / hy_plus );
-                    uy_flux_plus( i, j, k, 1 ) = ( POW2( vy_plus ) / hy_plus + ghalf * POW2( hy_plus ) );
-
-                    // DEBUG: Print hy_flux_plus, uy_flux_plus, uy_flux_plus, i, j, k
-                    // if ( DEBUG ) std::cout << std::left << std::setw( 10 ) << "hy_flux_plus: " << std::setw( 6 ) << hy_flux_plus( i, j, k, 0 ) << \
-                    "\tuy_flux_plus: " << std::setw( 6 ) << uy_flux_plus( i, j, k, 0 ) << "\tuy_flux_plus: " << std::setw( 6 ) << uy_flux_plus( i, j, k, 1 ) << \
-                    "\ti: " << i << "\tj: " << j << "\tk: " << k << "\n";
-
-                    // Flux Corrector Calculations
-                    // X Direction
-                    hx_w_minus( i, j, k, 0 ) = wCorrector( dt, dx, fabs( ux_minus / hx_minus ) + sqrt( gravity * hx_minus ), h_ic - h_left, h_left - h_left2, h_right - h_ic );
-                    hx_w_minus( i, j, k, 0 ) *= h_ic - h_left;
-
-                    hx_w_plus( i, j, k, 0 ) = wCorrector( dt, dx, fabs( ux_plus / hx_plus ) + sqrt( gravity * hx_plus ), h_right - h_ic, h_ic - h_left, h_right2 - h_right );
-                    hx_w_plus( i, j, k, 0 ) *= h_right - h_ic;
-
-                    u_w_minus( i, j, k, 0 ) = wCorrector( dt, dx, fabs( ux_minus / hx_minus ) + sqrt( gravity * hx_minus ), u_ic - u_left, u_left - u_left2, u_right - u_ic );
-                    u_w_minus( i, j, k, 0 ) *= u_ic - u_left;
-
-                    u_w_plus( i, j, k, 0 ) = wCorrector( dt, dx, fabs( ux_plus / hx_plus ) + sqrt( gravity * hx_plus ), u_right - u_ic, u_ic - u_left, u_right2 - u_right );
-                    u_w_plus( i, j, k, 0 ) *= u_right - u_ic;
-
-                    // DEBUG: Print hx_w_minus, hx_w_plus, u_w_minus, u_w_plus, i, j, k
-                    // if ( DEBUG ) std::cout << std::left << std::setw( 10 ) << "hx_w_minus: " << std::setw( 6 ) << hx_w_minus( i, j, k, 0 ( i, j, k, 0 ) << "\thx_w_plus: " << std::setw( 6 ) << hx_w_plus( i, j, k, 0 ) <<\
-                    "\tu_w_minus: " << std::setw( 6 ) << u_w_minus( i, j, k, 0 ) << "\tu_w_plus: " << std::setw( 6 ) << u_w_plus( i, j, k, 0 ) << \
-                    "\ti: " << i << "\tj: " << j << "\tk: " << k << "\n";
-
-                    // Y Direction
-                    hy_w_minus( i, j, k, 0 ) = wCorrector( dt, dy, fabs( vy_minus / hy_minus ) + sqrt( gravity * hy_minus ), h_ic - h_bot, h_bot - h_bot2, h_top - h_ic );
-                    hy_w_minus( i, j, k, 0 ) *= h_ic - h_bot;
-
-                    hy_w_plus( i, j, k, 0 ) = wCorrector( dt, dy, fabs( vy_plus / hy_plus ) + sqrt( gravity * hy_plus ), h_top - h_ic, h_ic - h_bot, h_top2 - h_top );
-                    hy_w_plus( i, j, k, 0 ) *= h_top - h_ic;
-
-                    u_w_minus( i, j, k, 1 ) = wCorrector( dt, dy, fabs( vy_minus / hy_minus ) + sqrt( gravity * hy_minus ), v_ic - v_bot, v_bot - v_bot2, v_top - v_ic );
-                    u_w_minus( i, j, k, 1 ) *= v_ic - v_bot;
-
-                    u_w_plus( i, j, k, 1 ) = wCorrector( dt, dy, fabs( vy_plus / hy_plus ) + sqrt( gravity * hy_plus ), v_top - v_ic, v_ic - v_bot, v_top2 - v_top );
-                    u_w_plus( i, j, k, 1 ) *= v_top - v_ic;
-
-                    // DEBUG: Print hy_w_minus, hy_w_plus, u_w_minus, u_w_plus, i, j, k
-                    // if ( DEBUG ) std::cout << std::left << std::setw( 10 ) << "hy_w_minus: " << std::setw( 6 ) << hy_w_minus( i, j, k, 0 ( i, j, k, 0 ) << "\thy_w_plus: " << std::setw( 6 ) << hy_w_plus( i, j, k, 0 ) <<\
-                    "\tu_w_minus: " << std::setw( 6 ) << u_w_minus( i, j, k, 1 ) << "\tu_w_plus: " << std::setw( 6 ) << u_w_plus( i, j, k, 1 ) << \
-                    "\ti: " << i << "\tj: " << j << "\tk: " << k << "\n";
-
-                    // Full Step Update
-                    h_new( i, j, k, 0 ) = uFullStep( dt, dx, h_ic, hx_flux_plus( i, j, k, 0 ), hx_flux_minus( i, j, k, 0 ), hy_flux_plus( i, j, k, 0 ), hy_flux_minus( i, j, k, 0 ) ) - hx_w_minus( i, j, k, 0 ) + hx_w_plus( i, j, k, 0 ) - hy_w_minus( i, j, k, 0 ) + hy_w_plus( i, j, k, 0 );
-                    u_new( i, j, k, 0 ) = uFullStep( dt, dx, u_ic, ux_flux_plus( i, j, k, 0 ), ux_flux_minus( i, j, k, 0 ), uy_flux_plus( i, j, k, 0 ), uy_flux_minus( i, j, k, 0 ) ) - u_w_minus( i, j, k, 0 ) + u_w_plus( i, j, k, 0 );
-                    u_new( i, j, k, 1 ) = uFullStep( dt, dy, v_ic, ux_flux_plus( i, j, k, 1 ), ux_flux_minus( i, j, k, 1 ), uy_flux_plus( i, j, k, 1 ), uy_flux_minus( i, j, k, 1 ) ) - u_w_minus( i, j, k, 1 ) + u_w_plus( i, j, k, 1 );
+                    state_t state[3];
+                    cellUpdate( dt, dx, dy, gravity, ghalf, h_x, h_y, u_x, u_y, v_x, v_y, state );
+
+                    // Round to the Storage Precision so Diagnostics Match the Stored State
+                    state_t h_full = static_cast<storage_t>( state[0] );
+                    state_t u_full = static_cast<storage_t>( state[1] );
+                    state_t v_full = static_cast<storage_t>( state[2] );
+
+                    h_new( i, j, k, 0 ) = h_full;
+                    u_new( i, j, k, 0 ) = u_full;
+                    u_new( i, j, k, 1 ) = v_full;
+
+                    // Next Time Step and Diagnostics from the Values Just Computed
+                    if ( diagnostics && inSpace( owned, i, j ) ) {
+                        state_t dt_next = ( diagnostics & DiagnosticType::bit( DiagnosticType::DT ) ) ? cellTimeStep( gravity, sigma, dx, dy, h_full, u_full, v_full ) : dt;
+                        diagnosticsAccumulate( lval, diagnostics, dt_next, h_full, u_full, v_full );
+                    }
 
                     // DEBUG: Print h_new, u_new, v_new, i, j, k
                     // if ( DEBUG ) std::cout << std::left << std::setw( 10 ) << "h_new: " << std::setw( 6 ) << h_new( i, j, k, 0 ) << \
                     "\tu_new: " << std::setw( 6 ) << u_new( i, j, k, 0 ) << "\tv_new: " << std::setw( 6 ) << u_new( i, j, k, 1 ) << "\ti: " << i << "\tj: " << j << "\tk: " << k << "\n";
+                },
+                DiagnosticsReducer<state_t, Kokkos::HostSpace>( local_diagnostics ) );
+
+            return local_diagnostics;
+        }
+
+/**
+ * Face-Based Time Step Iteration of Shallow Water Equations
+ * Computes the flux across every x-face and y-face once, then updates the cells from the face fluxes
+ * 
+ * @param pm Problem manager
+ * @param exec_space Execution space
+ * @param dt Time step (dt)
+ * @param gravity Gravitational constant
+ * @param sigma Factor to control CFL number, stability and size of time step
+ * @param diagnostics Mask of diagnostics to reduce from the new state values
+ * @param domain Cells to update: the domain, the domain and redundant ghost cells around it, or part of either
+ * @param time_step Current time step (count) 
+ * @return Local diagnostics of the new state
+**/
+        template <class ProblemManagerType, class ExecutionSpace, typename state_t>
+        DiagnosticValues<state_t> faceStep( const ProblemManagerType &pm, const ExecutionSpace &exec_space, const state_t dt, const state_t gravity, const state_t sigma, const int diagnostics, const Cajita::IndexSpace<3> &domain, const int time_step ) {
+            if ( pm.mesh()->rank() == 0 && DEBUG ) std::cout << "Face Time Stepper\n";
+
+            // Get dx and dy
+            state_t dx    = pm.mesh()->cellSize( 0 );
+            state_t dy    = pm.mesh()->cellSize( 1 );
+            state_t ghalf = 0.5 * gravity;
+
+            // Get Current State Views
+            auto u_current = pm.get( Location::Cell(), Field::Momentum(), CURRENTFIELD( time_step ) );
+            auto h_current = pm.get( Location::Cell(), Field::Height(), CURRENTFIELD( time_step ) );
+
+            // Get New State Views
+            auto u_new = pm.get( Location::Cell(), Field::Momentum(), NEWFIELD( time_step ) );
+            auto h_new = pm.get( Location::Cell(), Field::Height(), NEWFIELD( time_step ) );
+
+            // Precision the State is Stored in
+            typedef typename decltype( h_new )::non_const_value_type storage_t;
+
+            // Get Face Flux Views
+            auto x_flux = pm.get( Location::Face(), Field::XFlux() );
+            auto y_flux = pm.get( Location::Face(), Field::YFlux() );
+
+            // Only Cells of the Domain Itself Contribute to Diagnostics - Redundant Ghost Cells are Left Out
+            auto owned = pm.mesh()->domainSpace();
+
+            // Faces Bounding the Domain: Face i Lies Between Cells i - 1 and i
+            Cajita::IndexSpace<3> x_faces( { domain.min( 0 ), domain.min( 1 ), domain.min( 2 ) }, { domain.max( 0 ) + 1, domain.max( 1 ), domain.max( 2 ) } );
+            Cajita::IndexSpace<3> y_faces( { domain.min( 0 ), domain.min( 1 ), domain.min( 2 ) }, { domain.max( 0 ), domain.max( 1 ) + 1, domain.max( 2 ) } );
+
+            // Kokkos Parallel Section over X-Faces ( i, j, k )
+            Kokkos::parallel_for(
+                "X_Face_Flux", Cajita::createExecutionPolicy( x_faces, exec_space ), KOKKOS_LAMBDA( const int i, const int j, const int k ) {
+                    state_t h[4]  = { h_current( i - 2, j, k, 0 ), h_current( i - 1, j, k, 0 ), h_current( i, j, k, 0 ), h_current( i + 1, j, k, 0 ) };
+                    state_t un[4] = { u_current( i - 2, j, k, 0 ), u_current( i - 1, j, k, 0 ), u_current( i, j, k, 0 ), u_current( i + 1, j, k, 0 ) };
+                    state_t ut[4] = { u_current( i - 2, j, k, 1 ), u_current( i - 1, j, k, 1 ), u_current( i, j, k, 1 ), u_current( i + 1, j, k, 1 ) };
+
+                    state_t flux[5];
+                    faceFlux( dt, dx, gravity, ghalf, h, un, ut, flux );
+
+                    for ( int n = 0; n < 5; n++ ) x_flux( i, j, k, n ) = flux[n];
                 } );
+
+            // Kokkos Parallel Section over Y-Faces ( i, j, k )
+            Kokkos::parallel_for(
+                "Y_Face_Flux", Cajita::createExecutionPolicy( y_faces, exec_space ), KOKKOS_LAMBDA( const int i, const int j, const int k ) {
+                    state_t h[4]  = { h_current( i, j - 2, k, 0 ), h_current( i, j - 1, k, 0 ), h_current( i, j, k, 0 ), h_current( i, j + 1, k, 0 ) };
+                    state_t un[4] = { u_current( i, j - 2, k, 1 ), u_current( i, j - 1, k, 1 ), u_current( i, j, k, 1 ), u_current( i, j + 1, k, 1 ) };
+                    state_t ut[4] = { u_current( i, j - 2, k, 0 ), u_current( i, j - 1, k, 0 ), u_current( i, j, k, 0 ), u_current( i, j + 1, k, 0 ) };
+
+                    state_t flux[5];
+                    faceFlux( dt, dy, gravity, ghalf, h, un, ut, flux );
+
+                    for ( int n = 0; n < 5; n++ ) y_flux( i, j, k, n ) = flux[n];
+                } );
+
+            // Diagnostics of the New State
+            DiagnosticValues<state_t> local_diagnostics;
+
+            // Kokkos Parallel Section over Domain Space Indices to Sum Face Fluxes into New State Values ( i, j, k )
+            cellReduce(
+                "Face_Update", pm.order(), domain, exec_space, KOKKOS_LAMBDA( const int i, const int j, const int k, DiagnosticValues<state_t> &lval ) {
+                    // X-Flux Dofs: h, u, v, h corrector, u corrector - Y-Flux Dofs: h, v, u, h corrector, v corrector
+                    // New State is Rounded to the Storage Precision so Diagnostics Match the Stored State
+                    state_t h_full = static_cast<storage_t>( uFullStep<state_t>( dt, dx, h_current( i, j, k, 0 ), x_flux( i + 1, j, k, 0 ), x_flux( i, j, k, 0 ), y_flux( i, j + 1, k, 0 ), y_flux( i, j, k, 0 ) ) - x_flux( i, j, k, 3 ) + x_flux( i + 1, j, k, 3 ) - y_flux( i, j, k, 3 ) + y_flux( i, j + 1, k, 3 ) );
+                    state_t u_full = static_cast<storage_t>( uFullStep<state_t>( dt, dx, u_current( i, j, k, 0 ), x_flux( i + 1, j, k, 1 ), x_flux( i, j, k, 1 ), y_flux( i, j + 1, k, 2 ), y_flux( i, j, k, 2 ) ) - x_flux( i, j, k, 4 ) + x_flux( i + 1, j, k, 4 ) );
+                    state_t v_full = static_cast<storage_t>( uFullStep<state_t>( dt, dy, u_current( i, j, k, 1 ), x_flux( i + 1, j, k, 2 ), x_flux( i, j, k, 2 ), y_flux( i, j + 1, k, 1 ), y_flux( i, j, k, 1 ) ) - y_flux( i, j, k, 4 ) + y_flux( i, j + 1, k, 4 ) );
+
+                    h_new( i, j, k, 0 ) = h_full;
+                    u_new( i, j, k, 0 ) = u_full;
+                    u_new( i, j, k, 1 ) = v_full;
+
+                    // Next Time Step and Diagnostics from the Values Just Computed
+                    if ( diagnostics && inSpace( owned, i, j ) ) {
+                        state_t dt_next = ( diagnostics & DiagnosticType::bit( DiagnosticType::DT ) ) ? cellTimeStep( gravity, sigma, dx, dy, h_full, u_full, v_full ) : dt;
+                        diagnosticsAccumulate( lval, diagnostics, dt_next, h_full, u_full, v_full );
+                    }
+                },
+                DiagnosticsReducer<state_t, Kokkos::HostSpace>( local_diagnostics ) );
+
+            return local_diagnostics;
+        }
+
+/**
+ * Tiled Time Step Iteration of Shallow Water Equations
+ * Each team stages a ( tile + 2 * stencil halo ) patch of the current state in scratch memory and updates the tile from it
+ * 
+ * @param pm Problem manager
+ * @param exec_space Execution space
+ * @param dt Time step (dt)
+ * @param gravity Gravitational constant
+ * @param sigma Factor to control CFL number, stability and size of time step
+ * @param diagnostics Mask of diagnostics to reduce from the new state values
+ * @param tile Number of cells in a tile in the x and y directions - rounded up to whole storage tiles with tiled storage
+ * @param domain Cells to update: the domain, the domain and redundant ghost cells around it, or part of either
+ * @param time_step Current time step (count) 
+ * @return Local diagnostics of the new state
+**/
+        template <class ProblemManagerType, class ExecutionSpace, typename state_t>
+        DiagnosticValues<state_t> tiledStep( const ProblemManagerType &pm, const ExecutionSpace &exec_space, const state_t dt, const state_t gravity, const state_t sigma, const int diagnostics, const std::array<int, 2> &tile, const Cajita::IndexSpace<3> &domain, const int time_step ) {
+            if ( pm.mesh()->rank() == 0 && DEBUG ) std::cout << "Tiled Time Stepper\n";
+
+            typedef Kokkos::TeamPolicy<ExecutionSpace>                                                               team_policy;
+            typedef typename team_policy::member_type                                                                member_type;
+            typedef Kokkos::View<state_t **, typename ExecutionSpace::scratch_memory_space, Kokkos::MemoryUnmanaged> scratch_view;
+
+            // Get dx and dy
+            state_t dx    = pm.mesh()->cellSize( 0 );
+            state_t dy    = pm.mesh()->cellSize( 1 );
+            state_t ghalf = 0.5 * gravity;
+
+            // Get Current State Views
+            auto u_current = pm.get( Location::Cell(), Field::Momentum(), CURRENTFIELD( time_step ) );
+            auto h_current = pm.get( Location::Cell(), Field::Height(), CURRENTFIELD( time_step ) );
+
+            // Get New State Views
+            auto u_new = pm.get( Location::Cell(), Field::Momentum(), NEWFIELD( time_step ) );
+            auto h_new = pm.get( Location::Cell(), Field::Height(), NEWFIELD( time_step ) );
+
+            // Precision the State is Stored in
+            typedef typename decltype( h_new )::non_const_value_type storage_t;
+
+            // Only Cells of the Domain Itself Contribute to Diagnostics - Redundant Ghost Cells are Left Out
+            auto owned = pm.mesh()->domainSpace();
+
+            // Stencil Reaches Two Cells in Each Direction
+            const int halo = 2;
+
+            // Tiles Covering the Domain - Tiles on the Upper Edges May be Partial
+            // With Tiled Storage the Tiles are Rounded Up to Multiples of the Storage Tile and Start on Storage Tile Boundaries,
+            // so Each Team Reads Whole Storage Tiles
+            const long storage_tile = LayoutTile<typename decltype( h_current )::array_layout>::value;
+            int        tx = tile[0], ty = tile[1];
+            if ( storage_tile > 0 ) {
+                tx = ( ( tx + storage_tile - 1 ) / storage_tile ) * storage_tile;
+                ty = ( ( ty + storage_tile - 1 ) / storage_tile ) * storage_tile;
+            }
+            long xmin = domain.min( 0 ), ymin = domain.min( 1 ), kmin = domain.min( 2 );
+            long xmax = domain.max( 0 ), ymax = domain.max( 1 );
+            long x0   = ( storage_tile > 0 ) ? xmin - xmin % storage_tile : xmin;
+            long y0   = ( storage_tile > 0 ) ? ymin - ymin % storage_tile : ymin;
+            long ntx  = ( xmax - x0 + tx - 1 ) / tx;
+            long nty  = ( ymax - y0 + ty - 1 ) / ty;
+
+            // Scratch Patch for Height, X-Momentum, and Y-Momentum
+            int    px           = tx + 2 * halo;
+            int    py           = ty + 2 * halo;
+            size_t scratch_size = 3 * scratch_view::shmem_size( px, py );
+
+            // Diagnostics of the New State
+            DiagnosticValues<state_t> local_diagnostics;
+
+            // Kokkos Parallel Section over Tiles ( One Team per Tile )
+            Kokkos::parallel_reduce(
+                "Tiled_Finite_Volume", team_policy( exec_space, ntx * nty * domain.extent( 2 ), Kokkos::AUTO ).set_scratch_size( 0, Kokkos::PerTeam( scratch_size ) ), KOKKOS_LAMBDA( const member_type &team, DiagnosticValues<state_t> &lval ) {
+                    // Tile Origin and Extent
+                    long tile_id = team.league_rank() % ( ntx * nty );
+                    int  k       = kmin + team.league_rank() / ( ntx * nty );
+                    long ti      = x0 + ( tile_id % ntx ) * tx;
+                    long tj      = y0 + ( tile_id / ntx ) * ty;
+                    long i0      = ( ti > xmin ) ? ti : xmin;
+                    long j0      = ( tj > ymin ) ? tj : ymin;
+                    int  nix     = ( ( xmax < ti + tx ) ? xmax : ti + tx ) - i0;
+                    int  njy     = ( ( ymax < tj + ty ) ? ymax : tj + ty ) - j0;
+                    int  lx      = nix + 2 * halo;
+                    int  ly      = njy + 2 * halo;
+
+                    scratch_view h_tile( team.team_scratch( 0 ), px, py );
+                    scratch_view u_tile( team.team_scratch( 0 ), px, py );
+                    scratch_view v_tile( team.team_scratch( 0 ), px, py );
+
+                    // Stage Patch of the Current State in Scratch Memory
+                    Kokkos::parallel_for( Kokkos::TeamThreadRange( team, lx * ly ), [&]( const int n ) {
+                        int  a = n / ly, b = n % ly;
+                        long i = i0 - halo + a, j = j0 - halo + b;
+
+                        h_tile( a, b ) = h_current( i, j, k, 0 );
+                        u_tile( a, b ) = u_current( i, j, k, 0 );
+                        v_tile( a, b ) = u_current( i, j, k, 1 );
+                    } );
+
+                    team.team_barrier();
+
+                    // Update Tile Cells from the Patch
+                    DiagnosticValues<state_t> team_diagnostics;
+                    Kokkos::parallel_reduce(
+                        Kokkos::TeamThreadRange( team, nix * njy ), [&]( const int n, DiagnosticValues<state_t> &tval ) {
+                            int a = n / njy + halo, b = n % njy + halo;
+
+                            state_t h_x[5] = { h_tile( a - 2, b ), h_tile( a - 1, b ), h_tile( a, b ), h_tile( a + 1, b ), h_tile( a + 2, b ) };
+                            state_t h_y[5] = { h_tile( a, b - 2 ), h_tile( a, b - 1 ), h_tile( a, b ), h_tile( a, b + 1 ), h_tile( a, b + 2 ) };
+                            state_t u_x[5] = { u_tile( a - 2, b ), u_tile( a - 1, b ), u_tile( a, b ), u_tile( a + 1, b ), u_tile( a + 2, b ) };
+                            state_t u_y[5] = { u_tile( a, b - 2 ), u_tile( a, b - 1 ), u_tile( a, b ), u_tile( a, b + 1 ), u_tile( a, b + 2 ) };
+                            state_t v_x[5] = { v_tile( a - 2, b ), v_tile( a - 1, b ), v_tile( a, b ), v_tile( a + 1, b ), v_tile( a + 2, b ) };
+                            state_t v_y[5] = { v_tile( a, b - 2 ), v_tile( a, b - 1 ), v_tile( a, b ), v_tile( a, b + 1 ), v_tile( a, b + 2 ) };
+
+                            state_t state[3];
+                            cellUpdate( dt, dx, dy, gravity, ghalf, h_x, h_y, u_x, u_y, v_x, v_y, state );
+
+                            // Round to the Storage Precision so Diagnostics Match the Stored State
+                            for ( int c = 0; c < 3; c++ ) state[c] = static_cast<storage_t>( state[c] );
+
+                            long i = i0 + a - halo, j = j0 + b - halo;
+
+                            h_new( i, j, k, 0 ) = state[0];
+                            u_new( i, j, k, 0 ) = state[1];
+                            u_new( i, j, k, 1 ) = state[2];
+
+                            // Next Time Step and Diagnostics from the Values Just Computed
+                            if ( diagnostics && inSpace( owned, i, j ) ) {
+                                state_t dt_next = ( diagnostics & DiagnosticType::bit( DiagnosticType::DT ) ) ? cellTimeStep( gravity, sigma, dx, dy, state[0], state[1], state[2] ) : dt;
+                                diagnosticsAccumulate( tval, diagnostics, dt_next, state[0], state[1], state[2] );
+                            }
+                        },
+                        DiagnosticsReducer<state_t, Kokkos::HostSpace>( team_diagnostics ) );
+
+                    // One Contribution per Team
+                    Kokkos::single( Kokkos::PerTeam( team ), [&]() { diagnosticsJoin( lval, team_diagnostics ); } );
+                },
+                DiagnosticsReducer<state_t, Kokkos::HostSpace>( local_diagnostics ) );
+
+            return local_diagnostics;
+        }
+
+/**
+ * Explicitly Vectorized Time Step Iteration of Shallow Water Equations
+ * Each iteration updates a run of SIMD width cells along j, the unit stride direction of host views
+ * Row-major views load and store each stencil row of a run as a whole vector, other layouts gather it a lane at a time
+ * The final run of a row is shifted back to stay in the domain and only its new lanes are stored
+ * 
+ * @param pm Problem manager
+ * @param exec_space Execution space
+ * @param dt Time step (dt)
+ * @param gravity Gravitational constant
+ * @param sigma Factor to control CFL number, stability and size of time step
+ * @param diagnostics Mask of diagnostics to reduce from the new state values
+ * @param domain Cells to update: the domain, the domain and redundant ghost cells around it, or part of either
+ * @param time_step Current time step (count) 
+ * @return Local diagnostics of the new state
+**/
+        template <class ProblemManagerType, class ExecutionSpace, typename state_t>
+        DiagnosticValues<state_t> simdStep( const ProblemManagerType &pm, const ExecutionSpace &exec_space, const state_t dt, const state_t gravity, const state_t sigma, const int diagnostics, const Cajita::IndexSpace<3> &domain, const int time_step, std::true_type ) {
+            if ( pm.mesh()->rank() == 0 && DEBUG ) std::cout << "SIMD Time Stepper\n";
+
+            typedef Simd<state_t> simd_t;
+            const int             W = simd_t::size();
+
+            // Get dx and dy
+            state_t dx    = pm.mesh()->cellSize( 0 );
+            state_t dy    = pm.mesh()->cellSize( 1 );
+            state_t ghalf = 0.5 * gravity;
+
+            // Get Current State Views
+            auto u_current = pm.get( Location::Cell(), Field::Momentum(), CURRENTFIELD( time_step ) );
+            auto h_current = pm.get( Location::Cell(), Field::Height(), CURRENTFIELD( time_step ) );
+
+            // Get New State Views
+            auto u_new = pm.get( Location::Cell(), Field::Momentum(), NEWFIELD( time_step ) );
+            auto h_new = pm.get( Location::Cell(), Field::Height(), NEWFIELD( time_step ) );
+
+            // Precision the State is Stored in
+            typedef typename decltype( h_new )::non_const_value_type storage_t;
+
+            // Only Cells of the Domain Itself Contribute to Diagnostics - Redundant Ghost Cells are Left Out
+            auto owned = pm.mesh()->domainSpace();
+
+            // Row-Major Views Store a Run of Cells along J at a Fixed Stride - Height Contiguously, Momentum Interleaved
+            // Runs of Other Layouts are Gathered a Lane at a Time
+            bool rows = std::is_same<typename decltype( h_current )::array_layout, Kokkos::LayoutRight>::value && h_current.stride_1() == 1 && h_new.stride_1() == 1;
+            long us   = u_current.stride_1();
+            long uns  = u_new.stride_1();
+
+            // Runs of W Cells along J
+            long ymin = domain.min( 1 ), ymax = domain.max( 1 );
+            long nruns = ( domain.extent( 1 ) + W - 1 ) / W;
+
+            Cajita::IndexSpace<3> runs( { domain.min( 0 ), 0, domain.min( 2 ) }, { domain.max( 0 ), nruns, domain.max( 2 ) } );
+
+            // Diagnostics of the New State
+            DiagnosticValues<state_t> local_diagnostics;
+
+            // Kokkos Parallel Section over Runs of Cells ( i, run, k )
+            Kokkos::parallel_reduce(
+                "SIMD_Finite_Volume", Cajita::createExecutionPolicy( runs, exec_space ), KOKKOS_LAMBDA( const int i, const int run, const int k, DiagnosticValues<state_t> &lval ) {
+                    // First Cell of the Run - Shifted Back on the Last Run of a Row
+                    long jstart = ymin + run * W;
+                    long j0     = ( jstart + W <= ymax || ymax - ymin < W ) ? jstart : ymax - W;
+                    int  lmin   = jstart - j0;
+                    int  lmax   = ( ymax - j0 < W ) ? ymax - j0 : W;
+
+                    // Load Stencils - Whole Vectors from Row-Major Rows, Otherwise Lane by Lane
+                    simd_t h_x[5], h_y[5], u_x[5], u_y[5], v_x[5], v_y[5];
+                    if ( rows && lmax == W ) {
+                        for ( int s = 0; s < 5; s++ ) {
+                            h_x[s].copy_from( &h_current( i + s - 2, j0, k, 0 ) );
+                            h_y[s].copy_from( &h_current( i, j0 + s - 2, k, 0 ) );
+                            u_x[s].copy_from( &u_current( i + s - 2, j0, k, 0 ), us );
+                            u_y[s].copy_from( &u_current( i, j0 + s - 2, k, 0 ), us );
+                            v_x[s].copy_from( &u_current( i + s - 2, j0, k, 1 ), us );
+                            v_y[s].copy_from( &u_current( i, j0 + s - 2, k, 1 ), us );
+                        }
+                    } else {
+                        // Lanes Past the End of a Short Row Repeat the Last Cell
+                        for ( int l = 0; l < W; l++ ) {
+                            long j = j0 + ( ( l < lmax ) ? l : lmax - 1 );
+                            for ( int s = 0; s < 5; s++ ) {
+                                h_x[s][l] = h_current( i + s - 2, j, k, 0 );
+                                h_y[s][l] = h_current( i, j + s - 2, k, 0 );
+                                u_x[s][l] = u_current( i + s - 2, j, k, 0 );
+                                u_y[s][l] = u_current( i, j + s - 2, k, 0 );
+                                v_x[s][l] = u_current( i + s - 2, j, k, 1 );
+                                v_y[s][l] = u_current( i, j + s - 2, k, 1 );
+                            }
+                        }
+                    }
+
+                    // Shallow Water Equations on Every Lane
+                    simd_t state[3];
+                    cellUpdate( simd_t( dt ), simd_t( dx ), simd_t( dy ), simd_t( gravity ), simd_t( ghalf ), h_x, h_y, u_x, u_y, v_x, v_y, state );
+
+                    // Round to the Storage Precision so Diagnostics Match the Stored State
+                    for ( int c = 0; c < 3; c++ ) {
+                        for ( int l = 0; l < W; l++ ) state[c][l] = static_cast<storage_t>( state[c][l] );
+                    }
+
+                    // Store New Lanes - Whole Vectors Unless the Run was Shifted Back or is Short
+                    if ( rows && lmin == 0 && lmax == W ) {
+                        state[0].copy_to( &h_new( i, j0, k, 0 ) );
+                        state[1].copy_to( &u_new( i, j0, k, 0 ), uns );
+                        state[2].copy_to( &u_new( i, j0, k, 1 ), uns );
+                    } else {
+                        for ( int l = lmin; l < lmax; l++ ) {
+                            h_new( i, j0 + l, k, 0 ) = state[0][l];
+                            u_new( i, j0 + l, k, 0 ) = state[1][l];
+                            u_new( i, j0 + l, k, 1 ) = state[2][l];
+                        }
+                    }
+
+                    // Next Time Step and Diagnostics from the Values Just Computed
+                    if ( diagnostics ) {
+                        simd_t dt_next = ( diagnostics & DiagnosticType::bit( DiagnosticType::DT ) ) ? cellTimeStep( simd_t( gravity ), simd_t( sigma ), simd_t( dx ), simd_t( dy ), state[0], state[1], state[2] ) : simd_t( dt );
+                        for ( int l = lmin; l < lmax; l++ ) {
+                            if ( inSpace( owned, i, j0 + l ) ) diagnosticsAccumulate( lval, diagnostics, dt_next[l], state[0][l], state[1][l], state[2][l] );
+                        }
+                    }
+                },
+                DiagnosticsReducer<state_t, Kokkos::HostSpace>( local_diagnostics ) );
+
+            return local_diagnostics;
+        }
+
+/**
+ * Vectorized Time Step Iteration on a Non-Host Execution Space Falls Back to the Cell Kernel
+**/
+        template <class ProblemManagerType, class ExecutionSpace, typename state_t>
+        DiagnosticValues<state_t> simdStep( const ProblemManagerType &pm, const ExecutionSpace &exec_space, const state_t dt, const state_t gravity, const state_t sigma, const int diagnostics, const Cajita::IndexSpace<3> &domain, const int time_step, std::false_type ) {
+            return step( pm, exec_space, dt, gravity, sigma, diagnostics, domain, time_step );
+        }
+
+/**
+ * Explicitly Vectorized Time Step Iteration of Shallow Water Equations
+ * Selects the vectorized kernel on host execution spaces
+ * 
+ * @param pm Problem manager
+ * @param exec_space Execution space
+ * @param dt Time step (dt)
+ * @param gravity Gravitational constant
+ * @param sigma Factor to control CFL number, stability and size of time step
+ * @param diagnostics Mask of diagnostics to reduce from the new state values
+ * @param domain Cells to update: the domain, the domain and redundant ghost cells around it, or part of either
+ * @param time_step Current time step (count) 
+ * @return Local diagnostics of the new state
+**/
+        template <class ProblemManagerType, class ExecutionSpace, typename state_t>
+        DiagnosticValues<state_t> simdStep( const ProblemManagerType &pm, const ExecutionSpace &exec_space, const state_t dt, const state_t gravity, const state_t sigma, const int diagnostics, const Cajita::IndexSpace<3> &domain, const int time_step ) {
+            return simdStep( pm, exec_space, dt, gravity, sigma, diagnostics, domain, time_step, typename std::is_same<typename ExecutionSpace::memory_space, Kokkos::HostSpace>::type() );
+        }
+
+        /**
+ * Relative Height Jump to a Neighbor Above which an AMR Cell Refines
+ */
+        constexpr double amr_refine_jump = 0.10;
+
+        /**
+ * Relative Height Jump to Every Neighbor Below which an AMR Cell Coarsens
+ */
+        constexpr double amr_coarsen_jump = 0.02;
+
+        /**
+ * @struct AMRFaces
+ * @brief Face lists of an AMR mesh - x-faces and y-faces are kept apart so every face of a list has the same normal
+ * A list holds the lower ( left or bottom ) cell of every face followed by the upper ( right or top ) cell of every face,
+ * so a kernel over consecutive faces reads each column with unit stride
+ * A face on the domain boundary has -1 in place of the cell outside
+ */
+        template <class MemorySpace>
+        struct AMRFaces {
+            typedef Kokkos::View<int *[2], Kokkos::LayoutLeft, MemorySpace> face_view;
+
+            face_view x; /**< Left and right cell of every x-face */
+            face_view y; /**< Bottom and top cell of every y-face */
+        };
+
+/**
+ * Faces of an AMR Cell Normal to a Dimension that the Cell Lists
+ * A cell lists the face on its plus side unless the neighbor there is coarser, and both faces on its minus side when the neighbors there are finer,
+ * so a coarse-fine interface is listed by its coarse cell as one face per fine cell and every face is listed once
+ * Faces on the domain boundary are listed by the cell inside
+ *
+ * @param neighbors Left, right, bottom and top neighbor of every cell
+ * @param level Refinement level of every cell
+ * @param n Cell
+ * @param dim Dimension normal to the faces
+ * @param faces Lower and upper cell of every face listed, -1 outside the domain
+ * @return Number of faces listed
+**/
+        template <class NeighborView, class LevelSlice>
+        KOKKOS_INLINE_FUNCTION int amrCellFaces( const NeighborView &neighbors, const LevelSlice &level, const int n, const int dim, int faces[4][2] ) {
+            int minus = ( dim == 0 ) ? Side::LEFT : Side::BOTTOM;
+            int plus  = ( dim == 0 ) ? Side::RIGHT : Side::TOP;
+            int along = ( dim == 0 ) ? Side::TOP : Side::RIGHT; // The Second Finer Neighbor Across a Side is Past the First Along the Side
+            int count = 0;
+
+            // Minus Side - Domain Boundary or Both Finer Neighbors
+            int m = neighbors( n, minus );
+            if ( m == n ) {
+                faces[count][0]   = -1;
+                faces[count++][1] = n;
+            } else if ( level( m ) > level( n ) ) {
+                faces[count][0]   = m;
+                faces[count++][1] = n;
+                faces[count][0]   = neighbors( m, along );
+                faces[count++][1] = n;
+            }
+
+            // Plus Side - Domain Boundary, the Neighbor at the Same Level or Both Finer Neighbors
+            m = neighbors( n, plus );
+            if ( m == n ) {
+                faces[count][0]   = n;
+                faces[count++][1] = -1;
+            } else if ( level( m ) == level( n ) ) {
+                faces[count][0]   = n;
+                faces[count++][1] = m;
+            } else if ( level( m ) > level( n ) ) {
+                faces[count][0]   = n;
+                faces[count++][1] = m;
+                faces[count][0]   = n;
+                faces[count++][1] = neighbors( m, along );
+            }
+
+            return count;
+        }
+
+/**
+* Build the Face Lists of the Current AMR Mesh from its Neighbors
+* Faces are listed in the order of the cells listing them, so consecutive faces touch nearby cells
+* The lists are rebuilt whenever the mesh adapts
+*
+* @param pm Problem manager
+* @param exec_space Execution space
+* @return X-face and y-face lists
+**/
+        template <class MemorySpace, class ProblemManagerType, class ExecutionSpace>
+        AMRFaces<MemorySpace> amrFaces( const ProblemManagerType &pm, const ExecutionSpace &exec_space ) {
+            int  size      = pm.mesh()->size();
+            auto level     = Cabana::slice<2>( pm.mesh()->cells() );
+            auto neighbors = pm.neighbors();
+
+            AMRFaces<MemorySpace> faces;
+
+            for ( int dim = 0; dim < 2; dim++ ) {
+                // Faces Each Cell Lists
+                Kokkos::View<int *, MemorySpace> offsets( "amr_face_offsets", size + 1 );
+                Kokkos::parallel_for(
+                    "AMR_Face_Count", Kokkos::RangePolicy<ExecutionSpace>( exec_space, 0, size ), KOKKOS_LAMBDA( const int n ) {
+                        int cell_faces[4][2];
+                        offsets( n ) = amrCellFaces( neighbors, level, n, dim, cell_faces );
+                    } );
+
+                // Exclusive Prefix Sum - the Entry Past the Last Cell Receives the Face Count
+                Kokkos::parallel_scan(
+                    "AMR_Face_Offsets", Kokkos::RangePolicy<ExecutionSpace>( exec_space, 0, size + 1 ), KOKKOS_LAMBDA( const int n, int &sum, const bool final ) {
+                        int count = ( n < size ) ? offsets( n ) : 0;
+                        if ( final ) offsets( n ) = sum;
+                        sum += count;
+                    } );
+
+                int count;
+                Kokkos::deep_copy( count, Kokkos::subview( offsets, size ) );
+
+                // Write the Faces
+                typename AMRFaces<MemorySpace>::face_view list( Kokkos::ViewAllocateWithoutInitializing( ( dim == 0 ) ? "amr_x_faces" : "amr_y_faces" ), count );
+                Kokkos::parallel_for(
+                    "AMR_Face_List", Kokkos::RangePolicy<ExecutionSpace>( exec_space, 0, size ), KOKKOS_LAMBDA( const int n ) {
+                        int cell_faces[4][2];
+                        int listed = amrCellFaces( neighbors, level, n, dim, cell_faces );
+                        for ( int f = 0; f < listed; f++ ) {
+                            list( offsets( n ) + f, 0 ) = cell_faces[f][0];
+                            list( offsets( n ) + f, 1 ) = cell_faces[f][1];
+                        }
+                    } );
+
+                if ( dim == 0 )
+                    faces.x = list;
+                else
+                    faces.y = list;
+            }
+
+            return faces;
+        }
+
+/**
+* Calculate dynamic time step of an AMR mesh based off of wave speed and the size of each cell
+*
+* @param pm Problem manager
+* @param exec_space Execution space
+* @param gravity Gravitational constant
+* @param sigma Factor to control CFL number, stability and size of time step
+* @param time_step Current time step
+**/
+        template <class ProblemManagerType, class ExecutionSpace, typename state_t>
+        state_t setAMRTimeStep( const ProblemManagerType &pm, const ExecutionSpace &exec_space, const state_t gravity, const state_t sigma, const int time_step ) {
+            int  size     = pm.mesh()->size();
+            auto geometry = pm.mesh()->geometry();
+            auto level    = Cabana::slice<2>( pm.mesh()->cells() );
+
+            // Get Current State Slices
+            auto h_current = pm.get( Location::Cell(), Field::Height(), CURRENTFIELD( time_step ) );
+            auto u_current = pm.get( Location::Cell(), Field::Momentum(), CURRENTFIELD( time_step ) );
+
+            // Initialize Overall Minimum Time Step
+            state_t dt_min;
+
+            Kokkos::parallel_reduce(
+                "AMR_Set_TimeStep", Kokkos::RangePolicy<ExecutionSpace>( exec_space, 0, size ), KOKKOS_LAMBDA( const int n, state_t &lmin ) {
+                    int     l  = level( n );
+                    state_t dt = cellTimeStep<state_t>( gravity, sigma, geometry.width( 0, l ), geometry.width( 1, l ), h_current( n ), u_current( n, 0 ), u_current( n, 1 ) );
+                    if ( dt < lmin ) lmin = dt;
+                },
+                Kokkos::Min<state_t>( dt_min ) );
+
+            // DEBUG: Print Overall Minimum Time Step
+            if ( DEBUG ) std::cout << "dt: " << dt_min << "\n";
+
+            return dt_min;
+        }
+
+/**
+* Reduce diagnostics of the current state of an AMR mesh
+* Mass and momentum are weighted by the area of each cell in coarse cells, so they compare with a regular mesh of the coarse cells
+*
+* @param pm Problem manager
+* @param exec_space Execution space
+* @param gravity Gravitational constant
+* @param sigma Factor to control CFL number, stability and size of time step
+* @param diagnostics Mask of diagnostics to reduce
+* @param time_step Current time step
+* @return Diagnostics of the current state
+**/
+        template <class ProblemManagerType, class ExecutionSpace, typename state_t>
+        DiagnosticValues<state_t> reduceAMRDiagnostics( const ProblemManagerType &pm, const ExecutionSpace &exec_space, const state_t gravity, const state_t sigma, const int diagnostics, const int time_step ) {
+            int  size     = pm.mesh()->size();
+            auto geometry = pm.mesh()->geometry();
+            auto level    = Cabana::slice<2>( pm.mesh()->cells() );
+
+            // Get Current State Slices
+            auto h_current = pm.get( Location::Cell(), Field::Height(), CURRENTFIELD( time_step ) );
+            auto u_current = pm.get( Location::Cell(), Field::Momentum(), CURRENTFIELD( time_step ) );
+
+            int weighted = DiagnosticType::bit( DiagnosticType::MASS ) | DiagnosticType::bit( DiagnosticType::MOMENTUM );
+
+            DiagnosticValues<state_t> local_diagnostics;
+
+            Kokkos::parallel_reduce(
+                "AMR_Diagnostics", Kokkos::RangePolicy<ExecutionSpace>( exec_space, 0, size ), KOKKOS_LAMBDA( const int n, DiagnosticValues<state_t> &lval ) {
+                    int     l    = level( n );
+                    state_t area = state_t( 1.0 ) / ( 1 << ( 2 * l ) );
+                    state_t h    = h_current( n );
+                    state_t u    = u_current( n, 0 );
+                    state_t v    = u_current( n, 1 );
+                    state_t dt   = cellTimeStep( gravity, sigma, geometry.width( 0, l ), geometry.width( 1, l ), h, u, v );
+
+                    diagnosticsAccumulate( lval, diagnostics & ~weighted, dt, h, u, v );
+                    diagnosticsAccumulate( lval, diagnostics & weighted, dt, area * h, area * u, area * v );
+                },
+                DiagnosticsReducer<state_t, Kokkos::HostSpace>( local_diagnostics ) );
+
+            return local_diagnostics;
+        }
+
+/**
+ * Flag the Cells of an AMR Mesh for Refinement from the Current State
+ * A cell refines where its height jumps relative to a neighbor by more than amr_refine_jump and coarsens where it jumps by less than amr_coarsen_jump to every neighbor
+ * The mesh keeps cells at the finest and coarsest levels and only merges four flagged siblings
+ *
+ * @param pm Problem manager
+ * @param exec_space Execution space
+ * @param time_step Current time step
+ * @return Refinement flag of every cell ( 1 - Refine, -1 - Coarsen, 0 - Keep )
+**/
+        template <class MemorySpace, class ProblemManagerType, class ExecutionSpace>
+        Kokkos::View<int *, MemorySpace> amrFlags( const ProblemManagerType &pm, const ExecutionSpace &exec_space, const int time_step ) {
+            int  size      = pm.mesh()->size();
+            auto neighbors = pm.neighbors();
+
+            // Get Current State Slices
+            auto h_current = pm.get( Location::Cell(), Field::Height(), CURRENTFIELD( time_step ) );
+
+            // Thresholds in the Precision of the State, Captured by the Kernel
+            typedef typename std::remove_cv<typename std::remove_reference<decltype( h_current( 0 ) )>::type>::type state_t;
+            const state_t refine_jump  = amr_refine_jump;
+            const state_t coarsen_jump = amr_coarsen_jump;
+
+            Kokkos::View<int *, MemorySpace> flags( "amr_flags", size );
+            Kokkos::parallel_for(
+                "AMR_Flags", Kokkos::RangePolicy<ExecutionSpace>( exec_space, 0, size ), KOKKOS_LAMBDA( const int n ) {
+                    state_t h    = h_current( n );
+                    state_t jump = 0.0;
+                    for ( int side = 0; side < 4; side++ ) jump = fmax( jump, fabs( h_current( neighbors( n, side ) ) - h ) / h );
+
+                    flags( n ) = ( jump > refine_jump ) ? 1 : ( ( jump < coarsen_jump ) ? -1 : 0 );
+                } );
+
+            return flags;
+        }
+
+/**
+ * Time Step Iteration of Shallow Water Equations on an AMR Mesh
+ * Computes the Lax-Wendroff flux and TVD flux corrector across every face of the face lists and adds them atomically to the cells on both sides,
+ * so whatever leaves a cell across a coarse-fine face enters its neighbor and the total mass is unchanged
+ * Across the domain boundary the cell outside mirrors the cell inside with its normal momentum reflected
+ * 
+ * @param pm Problem manager
+ * @param exec_space Execution space
+ * @param faces X-face and y-face lists of the current mesh
+ * @param dt Time step (dt)
+ * @param gravity Gravitational constant
+ * @param time_step Current time step (count) 
+**/
+        template <class ProblemManagerType, class ExecutionSpace, class FaceListType, typename state_t>
+        void amrStep( const ProblemManagerType &pm, const ExecutionSpace &exec_space, const FaceListType &faces, const state_t dt, const state_t gravity, const int time_step ) {
+            if ( pm.mesh()->rank() == 0 && DEBUG ) std::cout << "AMR Time Stepper\n";
+
+            int     size      = pm.mesh()->size();
+            auto    geometry  = pm.mesh()->geometry();
+            auto    level     = Cabana::slice<2>( pm.mesh()->cells() );
+            auto    neighbors = pm.neighbors();
+            state_t ghalf     = 0.5 * gravity;
+
+            // Get Current State Slices
+            auto u_current = pm.get( Location::Cell(), Field::Momentum(), CURRENTFIELD( time_step ) );
+            auto h_current = pm.get( Location::Cell(), Field::Height(), CURRENTFIELD( time_step ) );
+
+            // Get New State Slices
+            auto u_new = pm.get( Location::Cell(), Field::Momentum(), NEWFIELD( time_step ) );
+            auto h_new = pm.get( Location::Cell(), Field::Height(), NEWFIELD( time_step ) );
+
+            // The New State Starts from the Current State and the Faces Add What Flows into Each Cell
+            Kokkos::parallel_for(
+                "AMR_Copy", Kokkos::RangePolicy<ExecutionSpace>( exec_space, 0, size ), KOKKOS_LAMBDA( const int n ) {
+                    h_new( n )    = h_current( n );
+                    u_new( n, 0 ) = u_current( n, 0 );
+                    u_new( n, 1 ) = u_current( n, 1 );
+                } );
+
+            for ( int dim = 0; dim < 2; dim++ ) {
+                auto list  = ( dim == 0 ) ? faces.x : faces.y;
+                int  count = list.extent( 0 );
+                int  minus = ( dim == 0 ) ? Side::LEFT : Side::BOTTOM;
+                int  plus  = ( dim == 0 ) ? Side::RIGHT : Side::TOP;
+
+                // Kokkos Parallel Section over the Faces Normal to a Dimension
+                Kokkos::parallel_for(
+                    "AMR_Face_Flux", Kokkos::RangePolicy<ExecutionSpace>( exec_space, 0, count ), KOKKOS_LAMBDA( const int f ) {
+                        int a = list( f, 0 ), b = list( f, 1 );
+
+                        // Stencil Cells Ordered Left2, Left, Right, Right2 - a Cell Outside the Domain is the Mirror of a Cell Inside
+                        // A Cell that is its Own Neighbor Lies Against the Boundary, so the Cell Past it is its Mirror
+                        int     c[4]      = { ( a < 0 ) ? neighbors( b, plus ) : neighbors( a, minus ), ( a < 0 ) ? b : a, ( b < 0 ) ? a : b, ( b < 0 ) ? neighbors( a, minus ) : neighbors( b, plus ) };
+                        bool    mirror[4] = { a < 0 || c[0] == c[1], a < 0, b < 0, b < 0 || c[3] == c[2] };
+
+                        state_t h[4], un[4], ut[4];
+                        for ( int s = 0; s < 4; s++ ) {
+                            h[s]  = h_current( c[s] );
+                            un[s] = mirror[s] ? -u_current( c[s], dim ) : u_current( c[s], dim );
+                            ut[s] = u_current( c[s], 1 - dim );
+                        }
+
+                        // Distance Between the Cell Centers and Length of the Face, the Width of the Finer Cell
+                        int     l_a    = level( c[1] );
+                        int     l_b    = level( c[2] );
+                        state_t dr     = 0.5 * ( geometry.width( dim, l_a ) + geometry.width( dim, l_b ) );
+                        state_t length = geometry.width( 1 - dim, ( l_a > l_b ) ? l_a : l_b );
+
+                        state_t flux[5];
+                        faceFlux( dt, dr, gravity, ghalf, h, un, ut, flux );
+
+                        // Height, Normal and Tangential Momentum Moved from the Lower to the Upper Cell
+                        // Correctors Act Over the Area Between the Cell Centers, as on the Regular Mesh
+                        state_t moved[3] = { length * ( dt * flux[0] - dr * flux[3] ), length * ( dt * flux[1] - dr * flux[4] ), length * dt * flux[2] };
+
+                        if ( a >= 0 ) {
+                            state_t area = geometry.width( 0, l_a ) * geometry.width( 1, l_a );
+                            Kokkos::atomic_add( &h_new( a ), -moved[0] / area );
+                            Kokkos::atomic_add( &u_new( a, dim ), -moved[1] / area );
+                            Kokkos::atomic_add( &u_new( a, 1 - dim ), -moved[2] / area );
+                        }
+                        if ( b >= 0 ) {
+                            state_t area = geometry.width( 0, l_b ) * geometry.width( 1, l_b );
+                            Kokkos::atomic_add( &h_new( b ), moved[0] / area );
+                            Kokkos::atomic_add( &u_new( b, dim ), moved[1] / area );
+                            Kokkos::atomic_add( &u_new( b, 1 - dim ), moved[2] / area );
+                        }
+                    } );
+            }
         }
 
     } // namespace TimeIntegrator
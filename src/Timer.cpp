@@ -14,7 +14,8 @@
 namespace ExaCLAMR {
 
     Timer::Timer( int verbosity )
-        : _verbosity( verbosity ) {
+        : _verbosity( verbosity )
+        , _compute_time( 0 ) {
         if ( _verbosity == TimerType::OVERALL ) _time_overall.overall_time = 0;
         if ( _verbosity == TimerType::AGGREGATE ) {
             _time_aggregate.overall_time       = 0;
@@ -80,6 +81,8 @@ void Timer::setIterations( int iterations ) {
     void Timer::computeStop() {
         long long int duration = timerStop( _compute_start );
 
+        // Compute Time is Kept on Every Timer Level - Rebalancing Measures it
+        _compute_time += duration;
         if ( _verbosity == TimerType::AGGREGATE ) _time_aggregate.compute_time += duration;
     }
 
@@ -107,6 +110,11 @@ void Timer::setIterations( int iterations ) {
         if ( _verbosity == TimerType::AGGREGATE ) _time_aggregate.write_time += duration;
     }
 
+    // Accumulated Compute Time Method
+    long long int Timer::computeTime() const {
+        return _compute_time;
+    }
+
     // Timer Report Method
     void Timer::report() {
         std::cout << "Timing Report\n";
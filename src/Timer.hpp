@@ -145,6 +145,12 @@ struct TimeFunction {};
          **/
         void writeStop();
 
+        /**
+         * Return the compute time accumulated so far, on every timer level
+         * @return Compute time in microseconds
+         **/
+        long long int computeTime() const;
+
         /**
          * Print out timing report
          **/
@@ -157,6 +163,7 @@ struct TimeFunction {};
         // struct TimeFunction _time_function;
         struct TimeAggregate _time_aggregate; /**< Agggregate time tracker struct */
         struct TimeOverall   _time_overall;   /**< Overall time tracker struct */
+        long long int        _compute_time;   /**< Compute time tracker kept on every timer level */
 
         timepoint _overall_start;       /**< Overall start time stamp */
         timepoint _setup_start;         /**< Setup start time stamp */